@@ -35,7 +35,8 @@ enum {
   CONV_DIRECT = 2,
   CONV_DIRECT_VMG = 3,
   CONV_WINOGRAD = 4,
-  DECONV_DIRECT = 5
+  DECONV_DIRECT = 5,
+  DECONV_SUBPIXEL = 6
 };
 
 // Desc setup error
@@ -101,6 +102,30 @@ typedef enum {
 
 #define EL_NO_CALI (FLT_MAX)
 
+// Calibration method, see eld_conv_t::calibrate
+enum {
+  CALIB_MINMAX = 0,
+  CALIB_PERCENTILE,
+  CALIB_KL
+};
+
+// Activation algorithm, see eld_conv_t::activation
+enum {
+  ACT_RELU = 0,
+  ACT_LEAKY_RELU, // x < 0 ? alpha * x : x
+  ACT_CLIP,       // min(max(x, alpha), beta), ReLU6: alpha 0, beta 6
+  ACT_SIGMOID,
+  ACT_SWISH,      // x * sigmoid(alpha * x), SiLU: alpha 1
+  ACT_GELU_TANH,
+  ACT_GELU_ERF
+};
+
+// Pooling algorithm, see eld_conv_t::pool
+enum {
+  POOL_MAX = 0,
+  POOL_AVG
+};
+
 struct elx_conv_t;
 
 // Convolution desc
@@ -133,7 +158,7 @@ struct EULER_API eld_conv_t {
   int algorithm; // CONV_DIRECT | CONV_WINOGRAD
   int tile_size; // for Winograd only
 
-  bool with_relu;
+  bool with_relu; // activation epilogue, see activation
   bool with_bias;
   bool with_ip_sum;
   bool with_op_sum;
@@ -180,11 +205,143 @@ struct EULER_API eld_conv_t {
 
   // Internal data used by elx
   elx_conv_t *xc;
+
+  // Per output channel quantization coefficients of output, u8/s8 output
+  // only. scale/z point to at least dims.oc entries owned by user; z ==
+  // nullptr for all-zero. Overrides output_quant if scale != nullptr.
+  // A_fp32[oc] = scale[oc] * (A_quant[oc] - z[oc])
+  struct { float *scale, *z; } output_quant_oc;
+
+  // FP32 observe mode, eager mode only. If set before setup(), elx_conv()
+  // records min/max and histograms of input, output (also per channel)
+  // and Winograd transformed input.
+  bool observe;
+  // Fill input_quant, wino_tinput_quant, output_quant and output_quant_oc
+  // (if its arrays are given) of the INT8 desc q from observed statistics.
+  // percentile is used by CALIB_PERCENTILE only.
+  int calibrate(eld_conv_t &q, int method = CALIB_KL,
+      float percentile = 99.99f);
+
+  // Pooling fused into the conv output, FP32 conv only. dims.oh/ow are
+  // still the conv output sizes; the output tensor is the pooled one of
+  // pool.oh x pool.ow, computed by setup() without padding:
+  // pool.oh = (dims.oh - pool.kh) / pool.sh + 1
+  // alg: POOL_MAX | POOL_AVG
+  bool with_pool;
+  struct { int alg, kh, kw, sh, sw, oh, ow; } pool;
+
+  // Per output channel affine epilogue, FP32 weights only:
+  // A[oc] = scale[oc] * (conv[oc] + bias[oc]) + shift[oc]
+  // before inplace sum and ReLU. scale/shift point to dims.oc entries
+  // owned by user, read by setup(); shift == nullptr for all-zero.
+  // Folded into weights and bias, re-folded when elx_conv() gets other
+  // weights or bias.
+  struct { float *scale, *shift; } affine;
+  // Activation fused when with_relu is set, after inplace sum. ACT_RELU
+  // by default. u8/s8 output: applied to the dequantized output, per
+  // tensor output_quant only for other than ACT_RELU.
+  struct { int alg; float alpha, beta; } activation;
+
+  // Tensor views, nchw/nhwc/nChw16c only: input/output is the region at
+  // (c_off, h_off, w_off) of a user tensor of n x c x h x w, e.g. a slice
+  // of a concat, a crop or a halo-padded tensor. Out of the region is not
+  // read/written. c/h/w == 0 for dims of the input/output (pooled output
+  // with pool). nChw16c: c_off 16 aligned, dims.ic/oc too unless the
+  // region ends the channels. Regions of h/w and nhwc c are staged per
+  // image, others are zero copy.
+  struct { int c, c_off, h, h_off, w, w_off; } input_view, output_view;
+
+  // Input is pre-padded: a tensor of (ih + pads.t + pads.b) x (iw +
+  // pads.l + pads.r) with zero halo of pads around dims.ih x dims.iw,
+  // e.g. a halo-padded output view of the previous layer. Conv runs
+  // without padding, no border handling. input_view is of the padded
+  // input. Direct, 1x1 and Winograd; no INT8 depthwise.
+  bool input_prepadded;
+
+  // Inference batch-norm as the affine epilogue: fill scale/shift (dims.oc
+  // entries, owned by user) and point affine to them. gamma/beta ==
+  // nullptr for 1/0. Call before setup().
+  void fold_batch_norm(float *scale, float *shift, const float *mean,
+      const float *var, const float *gamma, const float *beta, float eps);
 };
 
 // Convolution execution
 int EULER_API elx_conv(eld_conv_t &desc, void *output, void *input, void *weights, void *bias);
 
+struct elx_gemm_t;
+
+// GEMM desc, row-major: C = op(A) * op(B) + bias, per matrix of a batch
+// op(A): m x k, op(B): k x n, C: m x n, op(X) = trans ? X^T : X
+//
+// Runs as the 1x1 conv of m pixels, k -> n channels on OTJ GEMM kernels.
+// B is the weights: shared by the batch and transformed at first
+// elx_gemm(), as conv weights of inference.
+//
+// FP32 batches of small matrices (m, n, k <= 256, e.g. attention heads)
+// and batches with B per matrix run as small GEMMs instead: one parallel
+// region over the batch, A/B packed to per-thread panels at each call.
+struct EULER_API eld_gemm_t {
+  struct { int m, n, k, batch; } dims;
+  struct { bool a, b; } trans;
+  // Leading dimensions, 0 for packed: k|m (A), n|k (B), n (C)
+  struct { int a, b, c; } ld;
+  // Elements between matrices of the batch, 0 for packed A/C; B is
+  // shared by the batch if 0, per matrix (FP32 only) otherwise
+  struct { size_t a, b, c; } batch_stride;
+
+  // Data type: f32 x f32 -> f32, or INT8 u8 x f32 -> u8|s8 with
+  // quantization of A and C, A_fp32 = scale * (A_quant - z)
+  struct { uint8_t a, b, c, bias; } data_type;
+  struct { float scale, z; } a_quant, c_quant;
+
+  bool with_bias;  // bias: n entries
+  bool with_sum;   // C += op(A) * op(B) + bias
+  bool with_relu;  // activation epilogue, see eld_conv_t::activation
+  struct { int alg; float alpha, beta; } activation;
+
+  // Blocking of the conv, 0 for auto by shape: register tile of T rows x
+  // O vectors of n, I vectors of k per kernel call
+  struct { int t, o, i; } blocking;
+  int nthreads;
+
+  eld_gemm_t();
+  ~eld_gemm_t();
+  eld_gemm_t(const eld_gemm_t&) = delete;
+  eld_gemm_t& operator=(const eld_gemm_t&) = delete;
+  int setup();
+
+  // Internal data used by elx
+  elx_gemm_t *xg;
+};
+
+// GEMM execution
+int EULER_API elx_gemm(eld_gemm_t &desc, void *c, void *a, void *b, void *bias);
+// Batched GEMM of dims.batch matrices at c[i], a[i], b[i], small GEMMs only
+int EULER_API elx_gemm_batch(eld_gemm_t &desc, void **c, void **a, void **b, void *bias);
+
+// Inner product (fully connected) desc: output[n][oc] = input[n][ic] *
+// weights[oc][ic]^T + bias[oc], the GEMM of m = n, k = ic, trans B
+struct EULER_API eld_ip_t {
+  struct { int n, ic, oc; } dims;
+  struct { uint8_t input, weights, output, bias; } data_type;
+  struct { float scale, z; } input_quant, output_quant;
+  bool with_bias;
+  bool with_relu;
+  struct { int alg; float alpha, beta; } activation;
+  int nthreads;
+
+  eld_ip_t();
+  eld_ip_t(const eld_ip_t&) = delete;
+  eld_ip_t& operator=(const eld_ip_t&) = delete;
+  int setup();
+
+  // Internal GEMM
+  eld_gemm_t gemm;
+};
+
+// Inner product execution
+int EULER_API elx_ip(eld_ip_t &desc, void *output, void *input, void *weights, void *bias);
+
 }
 
 #endif // __EULER_HPP__
@@ -28,6 +28,7 @@ function build() {
 function conv_test() {
   # Default
   n=1; g=1; i=0; o=0; h=0; w=0; H=0; W=0; k=3; K=3; p=1; P=1; s=1; S=1
+  dh=1; dw=1
   b=1; r=0; v=1; a=wino; l=16; B=0; A=0; T=0
   flt_o=0; flt_t=0; blk_i=0; blk_o=0; pat_i=1; pat_o=1
   tile_size=5; nthreads=0; execution_mode=0
@@ -35,6 +36,13 @@ function conv_test() {
   input_format=nChw16c; weights_format=OIhw16i16o; output_format=nChw16c
   input_as_blocked=0; weights_as_blocked=0; output_as_blocked=0
   with_ip_sum=0; with_argmax=0; f16c_opt=0; data_type_cfg=0
+  output_quant_oc=0; observe=0
+  pool=off; pool_k=2; pool_s=2; bn=0
+  act=relu; act_alpha=0; act_beta=0
+  input_view_c=0; input_view_c_off=0; output_view_c=0; output_view_c_off=0
+  input_view_h=0; input_view_h_off=0; input_view_w=0; input_view_w_off=0
+  output_view_h=0; output_view_h_off=0; output_view_w=0; output_view_w_off=0
+  input_prepadded=0; gemm=0
   input_file=""; weights_file=""; bias_file=""
   sampling_kind=2; tinput_cali_s=0; tinput_cali_z=0
   disable_autoparam=1
@@ -141,6 +149,98 @@ function conv_test() {
             ;;
           with-ip-sum=*) with_ip_sum=${OPTARG#*=}
             ;;
+          output-quant-oc) output_quant_oc="${!OPTIND}"; OPTIND=$(( $OPTIND + 1 ))
+            ;;
+          output-quant-oc=*) output_quant_oc=${OPTARG#*=}
+            ;;
+          observe) observe="${!OPTIND}"; OPTIND=$(( $OPTIND + 1 ))
+            ;;
+          observe=*) observe=${OPTARG#*=}
+            ;;
+          bn) bn="${!OPTIND}"; OPTIND=$(( $OPTIND + 1 ))
+            ;;
+          bn=*) bn=${OPTARG#*=}
+            ;;
+          pool) pool="${!OPTIND}"; OPTIND=$(( $OPTIND + 1 ))
+            ;;
+          pool=*) pool=${OPTARG#*=}
+            ;;
+          pool-k) pool_k="${!OPTIND}"; OPTIND=$(( $OPTIND + 1 ))
+            ;;
+          pool-k=*) pool_k=${OPTARG#*=}
+            ;;
+          pool-s) pool_s="${!OPTIND}"; OPTIND=$(( $OPTIND + 1 ))
+            ;;
+          pool-s=*) pool_s=${OPTARG#*=}
+            ;;
+          act) act="${!OPTIND}"; OPTIND=$(( $OPTIND + 1 ))
+            ;;
+          act=*) act=${OPTARG#*=}
+            ;;
+          act-alpha) act_alpha="${!OPTIND}"; OPTIND=$(( $OPTIND + 1 ))
+            ;;
+          act-alpha=*) act_alpha=${OPTARG#*=}
+            ;;
+          act-beta) act_beta="${!OPTIND}"; OPTIND=$(( $OPTIND + 1 ))
+            ;;
+          act-beta=*) act_beta=${OPTARG#*=}
+            ;;
+          input-view-c) input_view_c="${!OPTIND}"; OPTIND=$(( $OPTIND + 1 ))
+            ;;
+          input-view-c=*) input_view_c=${OPTARG#*=}
+            ;;
+          input-view-c-off) input_view_c_off="${!OPTIND}"; OPTIND=$(( $OPTIND + 1 ))
+            ;;
+          input-view-c-off=*) input_view_c_off=${OPTARG#*=}
+            ;;
+          output-view-c) output_view_c="${!OPTIND}"; OPTIND=$(( $OPTIND + 1 ))
+            ;;
+          output-view-c=*) output_view_c=${OPTARG#*=}
+            ;;
+          output-view-c-off) output_view_c_off="${!OPTIND}"; OPTIND=$(( $OPTIND + 1 ))
+            ;;
+          output-view-c-off=*) output_view_c_off=${OPTARG#*=}
+            ;;
+          input-view-h) input_view_h="${!OPTIND}"; OPTIND=$(( $OPTIND + 1 ))
+            ;;
+          input-view-h=*) input_view_h=${OPTARG#*=}
+            ;;
+          input-view-h-off) input_view_h_off="${!OPTIND}"; OPTIND=$(( $OPTIND + 1 ))
+            ;;
+          input-view-h-off=*) input_view_h_off=${OPTARG#*=}
+            ;;
+          input-view-w) input_view_w="${!OPTIND}"; OPTIND=$(( $OPTIND + 1 ))
+            ;;
+          input-view-w=*) input_view_w=${OPTARG#*=}
+            ;;
+          input-view-w-off) input_view_w_off="${!OPTIND}"; OPTIND=$(( $OPTIND + 1 ))
+            ;;
+          input-view-w-off=*) input_view_w_off=${OPTARG#*=}
+            ;;
+          output-view-h) output_view_h="${!OPTIND}"; OPTIND=$(( $OPTIND + 1 ))
+            ;;
+          output-view-h=*) output_view_h=${OPTARG#*=}
+            ;;
+          output-view-h-off) output_view_h_off="${!OPTIND}"; OPTIND=$(( $OPTIND + 1 ))
+            ;;
+          output-view-h-off=*) output_view_h_off=${OPTARG#*=}
+            ;;
+          output-view-w) output_view_w="${!OPTIND}"; OPTIND=$(( $OPTIND + 1 ))
+            ;;
+          output-view-w=*) output_view_w=${OPTARG#*=}
+            ;;
+          output-view-w-off) output_view_w_off="${!OPTIND}"; OPTIND=$(( $OPTIND + 1 ))
+            ;;
+          output-view-w-off=*) output_view_w_off=${OPTARG#*=}
+            ;;
+          input-prepadded) input_prepadded="${!OPTIND}"; OPTIND=$(( $OPTIND + 1 ))
+            ;;
+          input-prepadded=*) input_prepadded=${OPTARG#*=}
+            ;;
+          gemm) gemm="${!OPTIND}"; OPTIND=$(( $OPTIND + 1 ))
+            ;;
+          gemm=*) gemm=${OPTARG#*=}
+            ;;
           with-argmax) with_argmax="${!OPTIND}"; OPTIND=$(( $OPTIND + 1 ))
             ;;
           with-argmax=*) with_argmax=${OPTARG#*=}
@@ -181,6 +281,14 @@ function conv_test() {
             ;;
           disable-autoparam=*) disable_autoparam=${OPTARG#*=}
             ;;
+          dh) dh="${!OPTIND}"; OPTIND=$(( $OPTIND + 1 ))
+            ;;
+          dh=*) dh=${OPTARG#*=}
+            ;;
+          dw) dw="${!OPTIND}"; OPTIND=$(( $OPTIND + 1 ))
+            ;;
+          dw=*) dw=${OPTARG#*=}
+            ;;
        esac
        ;;
     esac
@@ -194,7 +302,7 @@ function conv_test() {
   if [ "x$bias_file" != "x" ]; then bias_file_opt="--bias-data-file=$bias_file"; fi
   set -v
   eval $OMP_ENV $ROOT_DIR/$build_dir/tests/elt_conv \
-    -mb=$n -g=$g -ic=$i -oc=$o -ih=$h -iw=$w -oh=$H -ow=$W -kh=$k -kw=$K -ph=$p -pw=$P -sh=$s -sw=$S \
+    -mb=$n -g=$g -ic=$i -oc=$o -ih=$h -iw=$w -oh=$H -ow=$W -kh=$k -kw=$K -ph=$p -pw=$P -sh=$s -sw=$S -dh=$dh -dw=$dw \
     -with_bias=$b -with_relu=$r -validate_results=$v -alg=$a -repeated_layer=$l -dbuffering=$B -output_as_input=$A \
     -flt_o=$flt_o -flt_t=$flt_t -blk_i=$blk_i -blk_o=$blk_o \
     -pat_i=$pat_i -pat_o=$pat_o -tile_size=$tile_size \
@@ -209,6 +317,18 @@ function conv_test() {
     -output_as_blocked=$output_as_blocked   \
     -with_ip_sum=$with_ip_sum \
     -with_argmax=$with_argmax \
+    -output_quant_oc=$output_quant_oc \
+    -observe=$observe \
+    -pool=$pool -pool_k=$pool_k -pool_s=$pool_s -bn=$bn \
+    -act=$act -act_alpha=$act_alpha -act_beta=$act_beta \
+    -input_view_c=$input_view_c -input_view_c_off=$input_view_c_off \
+    -output_view_c=$output_view_c -output_view_c_off=$output_view_c_off \
+    -input_view_h=$input_view_h -input_view_h_off=$input_view_h_off \
+    -input_view_w=$input_view_w -input_view_w_off=$input_view_w_off \
+    -output_view_h=$output_view_h -output_view_h_off=$output_view_h_off \
+    -output_view_w=$output_view_w -output_view_w_off=$output_view_w_off \
+    -input_prepadded=$input_prepadded \
+    -gemm=$gemm \
     -f16c_opt=$f16c_opt \
     -data_type_cfg=$data_type_cfg \
     -sampling_kind=$sampling_kind \
@@ -0,0 +1,40 @@
+#!/bin/bash
+
+ROOT_DIR="$(dirname $(cd "$(dirname "${BASH_SOURCE[0]}")" && pwd))"
+
+# 1x1 conv with stride and padding on in-place input (c060, nhwc a061)
+# and on transformed input (b061)
+function __val_conv() {
+  echo ====== Test conv-1x1-strided: $@ ======
+  $ROOT_DIR/scripts/run.sh -c -v1 -adirect_1x1 -n2 -k1 -K1 $@
+
+  if [ $? != 0 ]; then
+    echo "XXXXX FAILURE: XXXXX"
+    exit -1
+  fi
+}
+
+function val_conv() {
+  nhwc="--input-format=nhwc --weights-format=hwio --output-format=nhwc"
+  blks="--flt-t=7 --flt-o=1
+        --flt-t=8 --flt-o=2 --pat-o=2"
+
+  echo "$blks" | while read blk; do
+    __val_conv --execution-mode=0xc060 -i128 -o144 -h28 -w28 -H14 -W14 \
+      -p0 -P0 -s2 -S2 $blk -r1
+    __val_conv --execution-mode=0xc060 -i64 -o160 -h27 -w27 -H15 -W15 \
+      -p1 -P1 -s2 -S2 $blk --with-ip-sum=1
+    __val_conv --execution-mode=0xc060 -i64 -o128 -h14 -w14 -H16 -W16 \
+      -p1 -P1 $blk -r1
+    __val_conv --execution-mode=0xa061 -i128 -o144 -h28 -w28 -H14 -W14 \
+      -p0 -P0 -s2 -S2 $nhwc $blk
+    __val_conv --execution-mode=0xa061 -i64 -o136 -h27 -w27 -H15 -W15 \
+      -p1 -P1 -s2 -S2 $nhwc $blk -r1 --with-ip-sum=1
+    __val_conv --execution-mode=0xb061 -i64 -o160 -h27 -w27 -H15 -W15 \
+      -p1 -P1 -s2 -S2 $blk -r1
+  done || exit -1
+}
+
+set -x
+val_conv
+set +x
@@ -0,0 +1,47 @@
+#!/bin/bash
+
+ROOT_DIR="$(dirname $(cd "$(dirname "${BASH_SOURCE[0]}")" && pwd))"
+
+# 1x1 conv with Tr, O2r, oc3r tails and ic4 partition in all modes
+function __val_conv() {
+  echo ====== Test conv-1x1-tail: $@ ======
+  $ROOT_DIR/scripts/run.sh -c -v1 -adirect_1x1 -n2 -k1 -K1 -p0 -P0 $@
+
+  if [ $? != 0 ]; then
+    echo "XXXXX FAILURE: XXXXX"
+    exit -1
+  fi
+}
+
+function val_conv() {
+  plain="--input-format=nchw --weights-format=oihw --output-format=nchw"
+  nhwc="--input-format=nhwc --weights-format=hwio --output-format=nhwc"
+  # blocking: Tr (ow % T), O2r (oc2 % O), oc3r (oc34 % oc3), ic4
+  blks="--flt-t=6 --flt-o=1
+        --flt-t=8 --flt-o=2 --pat-o=1
+        --flt-t=6 --flt-o=2 --pat-o=2
+        --flt-t=6 --flt-o=1 --blk-i=2 --pat-i=2"
+
+  echo "$blks" | while read blk; do
+    for fmt in "$plain" "$nhwc"; do
+      __val_conv --execution-mode=0xa061 -i128 -o160 -h28 -w28 -H28 -W28 \
+        $fmt $blk
+      __val_conv --execution-mode=0xa061 -i128 -o144 -h28 -w28 -H14 -W14 \
+        -s2 -S2 $fmt $blk -r1
+      __val_conv --execution-mode=0xf061 -i128 -o160 -h14 -w14 -H14 -W14 \
+        $fmt $blk --with-ip-sum=1
+    done
+    __val_conv --execution-mode=0xb061 -i128 -o160 -h28 -w28 -H14 -W14 \
+      -s2 -S2 $blk
+    __val_conv --execution-mode=0xc060 -i128 -o144 -h14 -w14 -H14 -W14 \
+      $blk -r1
+  done || exit -1
+
+  # padding: a061 only
+  __val_conv --execution-mode=0xa061 -i64 -o144 -h27 -w27 -H29 -W29 -p1 -P1 \
+    $plain --flt-t=8 --flt-o=2
+}
+
+set -x
+val_conv
+set +x
@@ -0,0 +1,51 @@
+#!/bin/bash
+
+ROOT_DIR="$(dirname $(cd "$(dirname "${BASH_SOURCE[0]}")" && pwd))"
+
+# Conv with fused activation epilogues
+function __val_conv() {
+  echo ====== Test conv-act: $@ ======
+  $ROOT_DIR/scripts/run.sh -c -v1 $@
+
+  if [ $? != 0 ]; then
+    echo "XXXXX FAILURE: XXXXX"
+    exit -1
+  fi
+}
+
+function val_conv() {
+  acts="--act=leaky_relu --act-alpha=0.1
+        --act=clip --act-alpha=0 --act-beta=6
+        --act=sigmoid
+        --act=swish --act-alpha=1
+        --act=gelu_tanh
+        --act=gelu_erf"
+
+  echo "$acts" | while read act; do
+    __val_conv -awino -n1 -i64 -o64 -h28 -w28 -H28 -W28 -k3 -K3 -p1 -P1 \
+      --tile-size=6 $act
+    __val_conv -adirect_1x1 -n1 -i64 -o128 -h28 -w28 -H28 -W28 -k1 -K1 \
+      -p0 -P0 $act
+    __val_conv -adirect -n1 -i32 -o64 -h56 -w56 -H28 -W28 -k3 -K3 -p1 -P1 \
+      -s2 -S2 --with-ip-sum=1 $act
+    __val_conv -adirect -n1 -i24 -o40 -h14 -w14 -H14 -W14 -k3 -K3 -p1 -P1 \
+      --input-format=nhwc --weights-format=hwio --output-format=nhwc $act
+    __val_conv -adirect -g32 -n1 -i32 -o32 -h28 -w28 -H28 -W28 -k3 -K3 \
+      -p1 -P1 --input-format=nhwc --weights-format=ghwio \
+      --output-format=nhwc $act
+    __val_conv -adeconv -n1 -i32 -o32 -h14 -w14 -H28 -W28 -k4 -K4 -p1 -P1 \
+      -s2 -S2 $act
+  done || exit -1
+
+  # INT8: activation on the dequantized output
+  __val_conv -awino -n1 -i64 -o64 -h28 -w28 -H28 -W28 -k3 -K3 -p1 -P1 \
+    --tile-size=6 --execution-mode=0xa161 --data-type-cfg=U8F32S8F32 \
+    --act=leaky_relu --act-alpha=0.1
+  __val_conv -adirect_1x1 -n1 -i64 -o128 -h28 -w28 -H28 -W28 -k1 -K1 \
+    -p0 -P0 --execution-mode=0xc160 --data-type-cfg=U8F32U8F32 \
+    --act=clip --act-alpha=0 --act-beta=6
+}
+
+set -x
+val_conv
+set +x
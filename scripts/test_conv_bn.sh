@@ -0,0 +1,43 @@
+#!/bin/bash
+
+ROOT_DIR="$(dirname $(cd "$(dirname "${BASH_SOURCE[0]}")" && pwd))"
+
+# Conv with folded inference batch-norm (per-oc affine epilogue)
+function __val_conv() {
+  echo ====== Test conv-bn: $@ ======
+  $ROOT_DIR/scripts/run.sh -c -v1 --bn=1 $@
+
+  if [ $? != 0 ]; then
+    echo "XXXXX FAILURE: XXXXX"
+    exit -1
+  fi
+}
+
+function val_conv() {
+  for b in 0 1; do
+    # Blocked weights
+    __val_conv -awino -n1 -i64 -o64 -h28 -w28 -H28 -W28 -k3 -K3 -p1 -P1 \
+      -b$b -r1 --tile-size=6
+    __val_conv -adirect_1x1 -n1 -i64 -o128 -h28 -w28 -H28 -W28 -k1 -K1 \
+      -p0 -P0 -b$b
+    __val_conv -adirect -n1 -i32 -o64 -h56 -w56 -H28 -W28 -k3 -K3 -p1 -P1 \
+      -s2 -S2 -b$b -r1 --with-ip-sum=1
+    # Plain weights, oc not a multiple of V
+    __val_conv -adirect -n1 -i24 -o40 -h14 -w14 -H14 -W14 -k3 -K3 -p1 -P1 \
+      -b$b --input-format=nhwc --weights-format=hwio --output-format=nhwc
+    __val_conv -adirect -g32 -n1 -i32 -o32 -h28 -w28 -H28 -W28 -k3 -K3 \
+      -p1 -P1 -b$b --input-format=nhwc --weights-format=ghwio \
+      --output-format=nhwc
+  done
+
+  # INT8: folded before weights quantization
+  __val_conv -awino -n1 -i64 -o64 -h28 -w28 -H28 -W28 -k3 -K3 -p1 -P1 \
+    --tile-size=6 --execution-mode=0xa161 --data-type-cfg=U8F32U8F32
+  # Deconv
+  __val_conv -adeconv -n1 -i32 -o32 -h14 -w14 -H28 -W28 -k4 -K4 -p1 -P1 \
+    -s2 -S2
+}
+
+set -x
+val_conv
+set +x
@@ -0,0 +1,49 @@
+#!/bin/bash
+
+ROOT_DIR="$(dirname $(cd "$(dirname "${BASH_SOURCE[0]}")" && pwd))"
+
+# Conv on channel views of concat tensors
+function __val_conv() {
+  echo ====== Test conv-concat: $@ ======
+  $ROOT_DIR/scripts/run.sh -c -v1 $@
+
+  if [ $? != 0 ]; then
+    echo "XXXXX FAILURE: XXXXX"
+    exit -1
+  fi
+}
+
+function val_conv() {
+  # nChw16c: output slice, input slice, unaligned last slice
+  __val_conv -awino -n2 -i64 -o64 -h28 -w28 -H28 -W28 -k3 -K3 -p1 -P1 \
+    --tile-size=6 --output-view-c=192 --output-view-c-off=64
+  __val_conv -adirect_1x1 -n2 -i64 -o128 -h28 -w28 -H28 -W28 -k1 -K1 \
+    -p0 -P0 --input-view-c=256 --input-view-c-off=128 \
+    --output-view-c=384 --output-view-c-off=256 --with-ip-sum=1
+  __val_conv -adirect -n2 -i32 -o40 -h14 -w14 -H14 -W14 -k3 -K3 -p1 -P1 \
+    --output-view-c=104 --output-view-c-off=64 -r1
+  __val_conv -adirect -n2 -i32 -o64 -h28 -w28 -H28 -W28 -k3 -K3 -p1 -P1 \
+    --output-view-c=128 --output-view-c-off=64 --pool=max
+
+  # nchw, nhwc
+  __val_conv -adirect -n2 -i3 -o32 -h56 -w56 -H56 -W56 -k3 -K3 -p1 -P1 \
+    --input-format=nchw --weights-format=oihw --output-format=nchw \
+    --output-view-c=80 --output-view-c-off=24
+  __val_conv -adirect -n2 -i24 -o40 -h14 -w14 -H14 -W14 -k3 -K3 -p1 -P1 \
+    --input-format=nhwc --weights-format=hwio --output-format=nhwc \
+    --input-view-c=56 --input-view-c-off=8 \
+    --output-view-c=100 --output-view-c-off=60 --with-ip-sum=1
+  __val_conv -adirect_1x1 -n2 -i64 -o96 -h28 -w28 -H28 -W28 -k1 -K1 \
+    -p0 -P0 --input-format=nhwc --weights-format=hwio --output-format=nhwc \
+    --output-view-c=256 --output-view-c-off=32
+
+  # INT8
+  __val_conv -adirect_1x1 -n2 -i64 -o128 -h28 -w28 -H28 -W28 -k1 -K1 \
+    -p0 -P0 --execution-mode=0xc160 --data-type-cfg=U8F32U8F32 \
+    --input-view-c=128 --input-view-c-off=64 \
+    --output-view-c=256 --output-view-c-off=128
+}
+
+set -x
+val_conv
+set +x
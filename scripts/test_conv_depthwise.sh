@@ -0,0 +1,46 @@
+#!/bin/bash
+
+ROOT_DIR="$(dirname $(cd "$(dirname "${BASH_SOURCE[0]}")" && pwd))"
+
+# FP32 depthwise convolution
+function __val_conv() {
+  echo ====== Test conv-depthwise: $@ ======
+  $ROOT_DIR/scripts/run.sh -c -v1 $@
+
+  if [ $? != 0 ]; then
+    echo "XXXXX FAILURE: XXXXX"
+    exit -1
+  fi
+}
+
+function val_conv() {
+  for fmt in nChw16c nhwc; do
+    opts="--input-format=$fmt --weights-format=ghwio --output-format=$fmt"
+    for s in 1 2; do
+      for k in 3 5 7; do
+        p=$(( $k / 2 ))
+        H=$(( (28 + 2 * $p - $k) / $s + 1 ))
+        __val_conv -adirect -g64 -n2 -i64 -o64 -h28 -w28 -H$H -W$H \
+          -k$k -K$k -p$p -P$p -s$s -S$s $opts
+        __val_conv -adirect -g32 -n1 -i32 -o32 -h28 -w28 -H$H -W$H \
+          -k$k -K$k -p$p -P$p -s$s -S$s -r1 --f16c-opt=1 $opts
+      done
+      # Dilation
+      H=$(( (28 + 4 - 5) / $s + 1 ))
+      __val_conv -adirect -g64 -n1 -i64 -o64 -h28 -w28 -H$H -W$H \
+        -k3 -K3 -p2 -P2 -s$s -S$s --dh=2 --dw=2 $opts
+    done
+  done
+
+  # Channels not a multiple of V
+  __val_conv -adirect -g24 -n1 -i24 -o24 -h14 -w14 -H14 -W14 \
+    -k3 -K3 -p1 -P1 -s1 -S1 -r1 \
+    --input-format=nhwc --weights-format=ghwio --output-format=nhwc
+  __val_conv -adirect -g40 -n1 -i40 -o40 -h14 -w14 -H7 -W7 \
+    -k5 -K5 -p2 -P2 -s2 -S2 --with-ip-sum=1 \
+    --input-format=nhwc --weights-format=ghwio --output-format=nhwc
+}
+
+set -x
+val_conv
+set +x
@@ -0,0 +1,48 @@
+#!/bin/bash
+
+ROOT_DIR="$(dirname $(cd "$(dirname "${BASH_SOURCE[0]}")" && pwd))"
+
+# Direct convolution with H x T 2-D register blocking
+function __val_conv() {
+  echo ====== Test direct-2d: $@ ======
+  $ROOT_DIR/scripts/run.sh -c -v1 -adirect --execution-mode=0xa061 $@
+
+  if [ $? != 0 ]; then
+    echo "XXXXX FAILURE: XXXXX"
+    exit -1
+  fi
+}
+
+function val_conv() {
+  for fmt in nChw16c nhwc; do
+    opts="--input-format=$fmt --weights-format=OIhw16i16o --output-format=$fmt"
+    for s in 1 2; do
+      for k in 3 5; do
+        p=$(( $k / 2 ))
+        H=$(( (28 + 2 * $p - $k) / $s + 1 ))
+        # H = 4, 2 and 1 rows, Hr and Tr tails
+        for T in 7 6 14; do
+          __val_conv -n1 -i64 -o64 -h28 -w28 -H$H -W$H -k$k -K$k -p$p -P$p \
+            -s$s -S$s --flt-t=$T -r1 $opts
+        done
+        __val_conv -n2 -i32 -o64 -h28 -w28 -H$H -W$H -k$k -K$k -p$p -P$p \
+          -s$s -S$s --flt-t=5 --flt-o=2 $opts
+      done
+    done
+    # No padding, dilation, ic partition
+    __val_conv -n1 -i64 -o32 -h15 -w15 -H13 -W13 -k3 -K3 -p0 -P0 -s1 -S1 \
+      --flt-t=4 --pat-i=2 $opts
+    __val_conv -n1 -i32 -o32 -h14 -w14 -H14 -W14 -k3 -K3 -p2 -P2 -s1 -S1 \
+      --dh=2 --dw=2 --flt-t=7 $opts
+    __val_conv -n1 -i32 -o32 -h14 -w14 -H14 -W14 -k3 -K3 -p1 -P1 -s1 -S1 \
+      --flt-t=7 --f16c-opt=1 $opts
+  done
+
+  # Tail ic/oc
+  __val_conv -n1 -i40 -o24 -h14 -w14 -H14 -W14 -k3 -K3 -p1 -P1 -s1 -S1 \
+    --flt-t=7 --input-format=nhwc --weights-format=hwio --output-format=nhwc
+}
+
+set -x
+val_conv
+set +x
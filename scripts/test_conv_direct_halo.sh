@@ -0,0 +1,38 @@
+#!/bin/bash
+
+ROOT_DIR="$(dirname $(cd "$(dirname "${BASH_SOURCE[0]}")" && pwd))"
+
+# Direct convolution with T <= lp or Tr <= rp
+function __val_conv() {
+  echo ====== Test direct-halo: $@ ======
+  $ROOT_DIR/scripts/run.sh -c -v1 -adirect $@
+
+  if [ $? != 0 ]; then
+    echo "XXXXX FAILURE: XXXXX"
+    exit -1
+  fi
+}
+
+function val_conv() {
+  for fmt in nChw16c nhwc; do
+    opts="--input-format=$fmt --weights-format=OIhw16i16o --output-format=$fmt"
+    for xopt in 0xa060 0xd060; do
+      # 7x7 s2 p3 stem
+      for T in 1 2 3 7; do
+        __val_conv -n1 -i16 -o32 -h56 -w56 -H28 -W28 -k7 -K7 -p3 -P3 -s2 -S2 \
+          --execution-mode=$xopt --flt-t=$T $opts
+      done
+      # Tr <= rp
+      __val_conv -n1 -i32 -o32 -h29 -w29 -H29 -W29 -k5 -K5 -p2 -P2 -s1 -S1 \
+        --execution-mode=$xopt --flt-t=14 $opts
+      __val_conv -n1 -i32 -o32 -h28 -w28 -H28 -W28 -k3 -K3 -p1 -P1 -s1 -S1 \
+        --execution-mode=$xopt --flt-t=1 $opts
+    done
+    __val_conv -n1 -i32 -o32 -h28 -w28 -H28 -W28 -k5 -K5 -p2 -P2 -s1 -S1 \
+      --execution-mode=0xb060 --flt-t=2 $opts
+  done
+}
+
+set -x
+val_conv
+set +x
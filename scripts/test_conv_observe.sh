@@ -0,0 +1,29 @@
+#!/bin/bash
+
+ROOT_DIR="$(dirname $(cd "$(dirname "${BASH_SOURCE[0]}")" && pwd))"
+
+# FP32 observe mode and calibration
+function __val_conv() {
+  echo ====== Test observe: $@ ======
+  $ROOT_DIR/scripts/run.sh -c -v1 --observe=1 --data-type-cfg=FP32 $@
+
+  if [ $? != 0 ]; then
+    echo "XXXXX FAILURE: XXXXX"
+    exit -1
+  fi
+}
+
+function val_conv() {
+  for r in 0 1; do
+    __val_conv -n1 -i64 -o128 -h28 -H28 -adirect -r$r
+    __val_conv -n1 -i64 -o128 -h28 -H28 -k1 -K1 -p0 -P0 -adirect_1x1 -r$r
+    __val_conv -n1 -i64 -o128 -h28 -H28 -awino -r$r --tile-size=6 \
+      --execution-mode=0xa061
+    __val_conv -n1 -i64 -o128 -h28 -H28 -awino -r$r --tile-size=4 \
+      --execution-mode=0xa033 --input-format=nchw --output-format=nchw
+  done
+}
+
+set -x
+val_conv
+set +x
@@ -0,0 +1,44 @@
+#!/bin/bash
+
+ROOT_DIR="$(dirname $(cd "$(dirname "${BASH_SOURCE[0]}")" && pwd))"
+
+# per output channel output quantization, u8/s8 output
+function __val_conv() {
+  echo ====== Test output-quant-oc: $@ ======
+  $ROOT_DIR/scripts/run.sh -c -v1 --output-quant-oc=1 $@
+
+  if [ $? != 0 ]; then
+    echo "XXXXX FAILURE: XXXXX"
+    exit -1
+  fi
+}
+
+function val_conv() {
+  for dt in U8F32U8F32 U8F32S8F32; do
+    for r in 0 1; do
+      # direct
+      __val_conv -n1 -i64 -o128 -h28 -H28 -adirect -r$r \
+        --execution-mode=0xa160 --data-type-cfg=$dt
+      __val_conv -n1 -i64 -o128 -h28 -H28 -adirect -r$r \
+        --execution-mode=0xd160 --data-type-cfg=$dt
+      # depthwise
+      __val_conv -n1 -g64 -i64 -o64 -h28 -H28 -adirect -r$r \
+        --execution-mode=0xa160 --data-type-cfg=$dt \
+        --weights-format=goihw
+      # 1x1
+      __val_conv -n1 -i64 -o128 -h28 -H28 -k1 -K1 -p0 -P0 -adirect_1x1 -r$r \
+        --execution-mode=0xc160 --data-type-cfg=$dt
+      __val_conv -n1 -i64 -o128 -h28 -H14 -k1 -K1 -p0 -P0 -s2 -S2 \
+        -adirect_1x1 -r$r --execution-mode=0xb161 --data-type-cfg=$dt
+      # winograd
+      __val_conv -n1 -i64 -o128 -h28 -H28 -awino -r$r --tile-size=6 \
+        --execution-mode=0xa161 --data-type-cfg=$dt
+      __val_conv -n1 -i64 -o128 -h28 -H28 -awino -r$r --tile-size=6 \
+        --execution-mode=0xa133 --data-type-cfg=$dt
+    done
+  done
+}
+
+set -x
+val_conv
+set +x
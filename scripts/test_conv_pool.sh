@@ -0,0 +1,44 @@
+#!/bin/bash
+
+ROOT_DIR="$(dirname $(cd "$(dirname "${BASH_SOURCE[0]}")" && pwd))"
+
+# Conv with fused max/avg pooling
+function __val_conv() {
+  echo ====== Test conv-pool: $@ ======
+  $ROOT_DIR/scripts/run.sh -c -v1 $@
+
+  if [ $? != 0 ]; then
+    echo "XXXXX FAILURE: XXXXX"
+    exit -1
+  fi
+}
+
+function val_conv() {
+  for pool in max avg; do
+    for fmt in nChw16c nhwc nchw; do
+      opts="--input-format=$fmt --output-format=$fmt --pool=$pool"
+      if [ $fmt == nChw16c ]; then opts="$opts --weights-format=OIhw16i16o"
+      else opts="$opts --weights-format=hwio"; fi
+      # Winograd, 2x2/2 (VGG) and 3x3/2
+      __val_conv -awino -n1 -i64 -o64 -h28 -w28 -H28 -W28 -k3 -K3 -p1 -P1 \
+        -r1 --tile-size=6 $opts
+      __val_conv -awino -n2 -i32 -o48 -h27 -w27 -H27 -W27 -k3 -K3 -p1 -P1 \
+        --tile-size=4 --pool-k=3 --pool-s=2 $opts
+      # 1x1
+      __val_conv -adirect_1x1 -n1 -i64 -o128 -h28 -w28 -H28 -W28 -k1 -K1 \
+        -p0 -P0 -r1 $opts
+      # Direct, stride 2 (early ResNet); no plain nchw output
+      if [ $fmt == nchw ]; then continue; fi
+      __val_conv -adirect -n1 -i32 -o64 -h56 -w56 -H28 -W28 -k3 -K3 -p1 -P1 \
+        -s2 -S2 -r1 --pool-k=3 --pool-s=2 $opts
+    done
+  done
+
+  # Channels not a multiple of V
+  __val_conv -adirect -n1 -i24 -o40 -h14 -w14 -H14 -W14 -k3 -K3 -p1 -P1 \
+    --input-format=nhwc --weights-format=hwio --output-format=nhwc --pool=avg
+}
+
+set -x
+val_conv
+set +x
@@ -0,0 +1,43 @@
+#!/bin/bash
+
+ROOT_DIR="$(dirname $(cd "$(dirname "${BASH_SOURCE[0]}")" && pwd))"
+
+# Conv on pre-padded input of zero halo
+function __val_conv() {
+  echo ====== Test conv-prepadded: $@ ======
+  $ROOT_DIR/scripts/run.sh -c -v1 --input-prepadded=1 $@
+
+  if [ $? != 0 ]; then
+    echo "XXXXX FAILURE: XXXXX"
+    exit -1
+  fi
+}
+
+function val_conv() {
+  __val_conv -adirect -n2 -i32 -o64 -h28 -w28 -H28 -W28 -k3 -K3 -p1 -P1
+  __val_conv -adirect -n2 -i32 -o64 -h56 -w56 -H28 -W28 -k3 -K3 -p1 -P1 \
+    -s2 -S2 --execution-mode=0xa061
+  __val_conv -adirect -n2 -i64 -o64 -h28 -w28 -H28 -W28 -k5 -K5 -p2 -P2 \
+    --execution-mode=0xd060
+  __val_conv -adirect -n1 -i24 -o40 -h14 -w14 -H14 -W14 -k3 -K3 -p1 -P1 \
+    --input-format=nhwc --weights-format=hwio --output-format=nhwc
+  __val_conv -adirect -g32 -n1 -i32 -o32 -h28 -w28 -H28 -W28 -k3 -K3 \
+    -p1 -P1 --input-format=nhwc --weights-format=ghwio --output-format=nhwc
+  # 1x1 of padding on c060
+  __val_conv -adirect_1x1 -n2 -i64 -o128 -h26 -w26 -H28 -W28 -k1 -K1 \
+    -p1 -P1 --execution-mode=0xc060
+  __val_conv -awino -n2 -i64 -o64 -h28 -w28 -H28 -W28 -k3 -K3 -p1 -P1 \
+    --tile-size=6
+  # halo in a larger input region
+  __val_conv -adirect -n2 -i32 -o64 -h28 -w28 -H28 -W28 -k3 -K3 -p1 -P1 \
+    --input-view-c=64 --input-view-h=32 --input-view-h-off=1 \
+    --input-view-w=32 --input-view-w-off=1
+
+  # INT8
+  __val_conv -adirect -n1 -i64 -o64 -h28 -w28 -H28 -W28 -k3 -K3 -p1 -P1 \
+    --execution-mode=0xd060 --data-type-cfg=U8F32U8F32
+}
+
+set -x
+val_conv
+set +x
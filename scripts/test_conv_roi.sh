@@ -0,0 +1,48 @@
+#!/bin/bash
+
+ROOT_DIR="$(dirname $(cd "$(dirname "${BASH_SOURCE[0]}")" && pwd))"
+
+# Conv on regions of padded/cropped tensors
+function __val_conv() {
+  echo ====== Test conv-roi: $@ ======
+  $ROOT_DIR/scripts/run.sh -c -v1 $@
+
+  if [ $? != 0 ]; then
+    echo "XXXXX FAILURE: XXXXX"
+    exit -1
+  fi
+}
+
+function val_conv() {
+  # halo-padded output for the next 3x3 layer
+  __val_conv -awino -n2 -i64 -o64 -h28 -w28 -H28 -W28 -k3 -K3 -p1 -P1 \
+    --tile-size=6 --output-view-h=30 --output-view-h-off=1 \
+    --output-view-w=30 --output-view-w-off=1
+  # crop of the input
+  __val_conv -adirect -n2 -i32 -o64 -h24 -w24 -H24 -W24 -k3 -K3 -p1 -P1 \
+    --input-view-h=32 --input-view-h-off=3 --input-view-w=28 \
+    --input-view-w-off=4 --with-ip-sum=1
+  __val_conv -adirect_1x1 -n2 -i64 -o128 -h28 -w28 -H28 -W28 -k1 -K1 \
+    -p0 -P0 --input-view-h=30 --input-view-h-off=1 --input-view-w=30 \
+    --input-view-w-off=1 --output-view-c=256 --output-view-c-off=128 \
+    --output-view-h=30 --output-view-h-off=1 --output-view-w=30 \
+    --output-view-w-off=1
+  __val_conv -adirect -n2 -i32 -o64 -h28 -w28 -H28 -W28 -k3 -K3 -p1 -P1 \
+    --pool=max --output-view-h=16 --output-view-h-off=1 --output-view-w=16 \
+    --output-view-w-off=1
+
+  # nchw, nhwc
+  __val_conv -adirect -n2 -i3 -o32 -h56 -w56 -H56 -W56 -k3 -K3 -p1 -P1 \
+    --input-format=nchw --weights-format=oihw --output-format=nchw \
+    --input-view-h=60 --input-view-h-off=2 --output-view-w=58 \
+    --output-view-w-off=1
+  __val_conv -adirect -n2 -i24 -o40 -h14 -w14 -H14 -W14 -k3 -K3 -p1 -P1 \
+    --input-format=nhwc --weights-format=hwio --output-format=nhwc \
+    --input-view-c=32 --input-view-h=16 --input-view-h-off=1 \
+    --output-view-h=16 --output-view-h-off=1 --output-view-w=16 \
+    --output-view-w-off=1 --with-ip-sum=1
+}
+
+set -x
+val_conv
+set +x
@@ -0,0 +1,43 @@
+#!/bin/bash
+
+ROOT_DIR="$(dirname $(cd "$(dirname "${BASH_SOURCE[0]}")" && pwd))"
+
+# Fused inplace sum + ReLU with plain format output
+function __val_conv() {
+  echo ====== Test conv-sum-relu: $@ ======
+  $ROOT_DIR/scripts/run.sh -c -v1 -r1 --with-ip-sum=1 $@
+
+  if [ $? != 0 ]; then
+    echo "XXXXX FAILURE: XXXXX"
+    exit -1
+  fi
+}
+
+function val_conv() {
+  for fmt in "nchw oihw nchw" "nhwc hwio nhwc"; do
+    set -- $fmt
+    plain="--input-format=$1 --weights-format=$2 --output-format=$3"
+    for xopt in 0xa061 0xa073 0xa07b; do
+      __val_conv -awino -n2 -i64 -o64 -h28 -w28 -H28 -W28 -k3 -K3 -p1 -P1 \
+        --tile-size=6 --execution-mode=$xopt $plain
+    done
+    for xopt in 0xa061 0xf061; do
+      __val_conv -adirect_1x1 -n2 -i64 -o128 -h28 -w28 -H28 -W28 -k1 -K1 \
+        -p0 -P0 --execution-mode=$xopt $plain
+    done
+  done
+
+  # nchw output with oc tail
+  __val_conv -adirect_1x1 -n1 -i64 -o40 -h28 -w28 -H28 -W28 -k1 -K1 \
+    -p0 -P0 --execution-mode=0xf061 \
+    --input-format=nchw --weights-format=oihw --output-format=nchw
+  # nchw output computed as blocked
+  __val_conv -awino -n1 -i64 -o64 -h28 -w28 -H28 -W28 -k3 -K3 -p1 -P1 \
+    --tile-size=6 --execution-mode=0xa061 \
+    --input-format=nchw --weights-format=oihw --output-format=nchw \
+    --output-as-blocked=1
+}
+
+set -x
+val_conv
+set +x
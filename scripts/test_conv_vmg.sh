@@ -0,0 +1,43 @@
+#!/bin/bash
+
+ROOT_DIR="$(dirname $(cd "$(dirname "${BASH_SOURCE[0]}")" && pwd))"
+
+# Blocked group convolution with groups narrower than V
+function __val_conv() {
+  echo ====== Test conv-vmg: $@ ======
+  $ROOT_DIR/scripts/run.sh -c -v1 $@
+
+  if [ $? != 0 ]; then
+    echo "XXXXX FAILURE: XXXXX"
+    exit -1
+  fi
+}
+
+function val_conv() {
+  for fmt in nChw16c nhwc; do
+    opts="--input-format=$fmt --weights-format=ghwio --output-format=$fmt"
+    for s in 1 2; do
+      H=$(( 28 / $s ))
+      # ResNeXt, ShuffleNet, depthwise: icg = ocg = 4, 8, 1
+      for gc in "32 128" "8 64" "64 64"; do
+        set -- $gc
+        __val_conv -adirect_vmg -g$1 -n1 -i$2 -o$2 -h28 -w28 -H$H -W$H \
+          -k3 -K3 -p1 -P1 -s$s -S$s $opts
+      done
+      # icg < ocg
+      __val_conv -adirect_vmg -g16 -n1 -i32 -o64 -h28 -w28 -H$H -W$H \
+        -k3 -K3 -p1 -P1 -s$s -S$s --flt-t=7 $opts
+      __val_conv -adirect_vmg -g8 -n1 -i8 -o128 -h28 -w28 -H$H -W$H \
+        -k3 -K3 -p1 -P1 -s$s -S$s $opts
+    done
+  done
+
+  # Direct picks vmg for blocked format
+  __val_conv -adirect --disable-autoparam=0 -g32 -n1 -i128 -o128 \
+    -h28 -w28 -H28 -W28 -k3 -K3 -p1 -P1 -s1 -S1 \
+    --input-format=nChw16c --weights-format=ghwio --output-format=nChw16c
+}
+
+set -x
+val_conv
+set +x
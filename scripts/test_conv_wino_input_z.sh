@@ -0,0 +1,31 @@
+#!/bin/bash
+
+ROOT_DIR="$(dirname $(cd "$(dirname "${BASH_SOURCE[0]}")" && pwd))"
+
+# u8 input with non-zero zero point, INT8 Winograd
+function __val_conv() {
+  echo ====== Test wino-input-z: $@ ======
+  $ROOT_DIR/scripts/run.sh -c -v1 $@
+
+  if [ $? != 0 ]; then
+    echo "XXXXX FAILURE: XXXXX"
+    exit -1
+  fi
+}
+
+function val_conv() {
+  for dt in U8F32U8F32z U8F32S8F32z U8F32F32F32z; do
+    for ts in 4 5 6; do
+      __val_conv -n1 -i64 -o128 -h28 -H28 -awino -r1 --tile-size=$ts \
+        --execution-mode=0xa161 --data-type-cfg=$dt
+      __val_conv -n1 -i64 -o128 -h28 -H28 -awino -r1 --tile-size=$ts \
+        --execution-mode=0xa133 --data-type-cfg=$dt
+      __val_conv -n1 -i64 -o128 -h28 -H28 -awino -r1 --tile-size=$ts \
+        --execution-mode=0xa161 --data-type-cfg=$dt --input-format=nchw
+    done
+  done
+}
+
+set -x
+val_conv
+set +x
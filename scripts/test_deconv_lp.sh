@@ -0,0 +1,31 @@
+#!/bin/bash
+
+ROOT_DIR="$(dirname $(cd "$(dirname "${BASH_SOURCE[0]}")" && pwd))"
+
+# INT8 deconvolution, stride 1
+function __val_conv() {
+  echo ====== Test deconv-lp: $@ ======
+  $ROOT_DIR/scripts/run.sh -c -v1 $@
+
+  if [ $? != 0 ]; then
+    echo "XXXXX FAILURE: XXXXX"
+    exit -1
+  fi
+}
+
+function val_conv() {
+  for dt in U8F32U8F32 U8F32S8F32 U8F32F32F32; do
+    for fmt in nChw16c nhwc; do
+      __val_conv -n1 -i64 -o64 -h28 -w28 -H28 -W28 -adeconv -k3 -K3 -p1 -P1 -s1 -S1 \
+        --execution-mode=0xa160 --data-type-cfg=$dt --input-format=$fmt \
+        --weights-format=OIhw16i16o --output-format=$fmt
+      __val_conv -n1 -i64 -o64 -h28 -w28 -H28 -W28 -adeconv -k5 -K5 -p2 -P2 -s1 -S1 \
+        --execution-mode=0xa160 --data-type-cfg=$dt --input-format=$fmt \
+        --weights-format=OIhw16i16o --output-format=$fmt
+    done
+  done
+}
+
+set -x
+val_conv
+set +x
@@ -0,0 +1,35 @@
+#!/bin/bash
+
+ROOT_DIR="$(dirname $(cd "$(dirname "${BASH_SOURCE[0]}")" && pwd))"
+
+# Strided deconvolution by sub-pixel phases
+function __val_conv() {
+  echo ====== Test deconv-subpixel: $@ ======
+  $ROOT_DIR/scripts/run.sh -c -v1 $@
+
+  if [ $? != 0 ]; then
+    echo "XXXXX FAILURE: XXXXX"
+    exit -1
+  fi
+}
+
+function val_conv() {
+  for fmt in nChw16c nhwc; do
+    for wfmt in OIhw16i16o hwio; do
+      opts="-adeconv_subpixel --input-format=$fmt --weights-format=$wfmt --output-format=$fmt"
+      # 2x2 phases (d060)
+      __val_conv -n1 -i32 -o64 -h14 -w14 -H28 -W28 -k4 -K4 -p1 -P1 -s2 -S2 $opts
+      # 1x1 and 1x2 phases, odd output
+      __val_conv -n1 -i32 -o64 -h14 -w14 -H27 -W27 -k3 -K3 -p1 -P1 -s2 -S2 $opts
+      # 1x1 phases
+      __val_conv -n1 -i32 -o64 -h14 -w14 -H28 -W28 -k2 -K2 -p0 -P0 -s2 -S2 $opts
+      # 3x3 pad 1 phases (Winograd)
+      __val_conv -n1 -i32 -o64 -h14 -w14 -H28 -W28 -k6 -K6 -p2 -P2 -s2 -S2 $opts
+      __val_conv -n1 -i32 -o64 -h14 -w14 -H28 -W28 -k6 -K6 -p2 -P2 -s2 -S2 -r1 $opts
+    done
+  done
+}
+
+set -x
+val_conv
+set +x
@@ -0,0 +1,51 @@
+#!/bin/bash
+
+ROOT_DIR="$(dirname $(cd "$(dirname "${BASH_SOURCE[0]}")" && pwd))"
+
+# GEMM/inner product (eld_gemm_t) validated as the 1x1 conv of nhwc output:
+# m = h * w, batch = n; nchw input as A^T, oihw weights as B^T
+function __val_gemm() {
+  echo ====== Test gemm: $@ ======
+  $ROOT_DIR/scripts/run.sh -c -v1 -adirect_1x1 --execution-mode=0xa061 \
+    -k1 -K1 -p0 -P0 --gemm=1 --output-format=nhwc $@
+
+  if [ $? != 0 ]; then
+    echo "XXXXX FAILURE: XXXXX"
+    exit -1
+  fi
+}
+
+function val_gemm() {
+  fmts="--input-format=nhwc --weights-format=hwio
+        --input-format=nhwc --weights-format=oihw
+        --input-format=nchw --weights-format=hwio"
+
+  echo "$fmts" | while read fmt; do
+    # transformer projections, tall-skinny
+    __val_gemm -n1 -i1024 -o1024 -h1 -w42 -H1 -W42 $fmt
+    __val_gemm -n1 -i4096 -o1024 -h1 -w42 -H1 -W42 $fmt -r1
+    __val_gemm -n2 -i1024 -o16 -h1 -w100 -H1 -W100 $fmt
+    # GEMV, batch 1 inner product
+    __val_gemm -n1 -i512 -o1000 -h1 -w1 -H1 -W1 $fmt
+    # k, n tails, batch
+    __val_gemm -n3 -i100 -o72 -h5 -w7 -H5 -W7 $fmt --with-ip-sum=1
+  done || exit -1
+
+  # Small GEMMs: attention heads, n/k tails, by elx_gemm and elx_gemm_batch
+  for g in 1 2; do
+    __val_gemm -n64 -i64 -o64 -h1 -w64 -H1 -W64 --input-format=nhwc \
+      --weights-format=hwio --gemm=$g
+    __val_gemm -n12 -i64 -o128 -h8 -w16 -H8 -W16 --input-format=nchw \
+      --weights-format=oihw --gemm=$g --with-ip-sum=1 -r1
+    __val_gemm -n5 -i40 -o24 -h3 -w11 -H3 -W11 --input-format=nhwc \
+      --weights-format=oihw --gemm=$g
+  done
+
+  # INT8: u8 x f32 -> u8
+  __val_gemm -n1 -i1024 -o1024 -h1 -w42 -H1 -W42 --input-format=nhwc \
+    --weights-format=hwio --data-type-cfg=U8F32U8F32 --execution-mode=0xc160
+}
+
+set -x
+val_gemm
+set +x
@@ -0,0 +1,114 @@
+#pragma once
+
+#include <x86intrin.h>
+#include "euler.hpp"
+#include "el_intrin.hpp"
+
+// Vectorized activation functions of conv epilogues (ACT_*)
+
+namespace euler {
+
+template <int V> struct eltwise {
+};
+
+#ifdef __AVX512F__
+template <> struct eltwise<16> {
+  static inline __m512 fmadd(__m512 a, __m512 b, float c) {
+    return _mm512_fmadd_ps(a, b, _mm512_set1_ps(c));
+  }
+
+  // exp(x), x clamped to [-87.3, 88.37]. Cephes expf polynomial, relative
+  // error about 2e-7.
+  static inline __m512 exp_ps(__m512 x) {
+    x = _mm512_min_ps(_mm512_max_ps(x, _mm512_set1_ps(-87.3f)),
+                      _mm512_set1_ps(88.37f));
+    // x = n * ln2 + r, |r| <= ln2 / 2
+    __m512 n = _mm512_roundscale_ps(
+        _mm512_mul_ps(x, _mm512_set1_ps(1.44269504f)),
+        _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    __m512 r = _mm512_fnmadd_ps(n, _mm512_set1_ps(0.693359375f), x);
+    r = _mm512_fnmadd_ps(n, _mm512_set1_ps(-2.12194440e-4f), r);
+
+    __m512 p = _mm512_set1_ps(1.9875691500e-4f);
+    p = fmadd(p, r, 1.3981999507e-3f);
+    p = fmadd(p, r, 8.3334519073e-3f);
+    p = fmadd(p, r, 4.1665795894e-2f);
+    p = fmadd(p, r, 1.6666665459e-1f);
+    p = fmadd(p, r, 5.0000001201e-1f);
+    p = _mm512_fmadd_ps(_mm512_mul_ps(p, r), r, r);
+    p = _mm512_add_ps(p, _mm512_set1_ps(1.0f));
+    return _mm512_scalef_ps(p, n);
+  }
+
+  static inline __m512 sigmoid_ps(__m512 x) {
+    __m512 one = _mm512_set1_ps(1.0f);
+    __m512 e = exp_ps(_mm512_sub_ps(_mm512_setzero_ps(), x));
+    return _mm512_div_ps(one, _mm512_add_ps(one, e));
+  }
+
+  // x * Phi(x), Phi(x) = erfc(-x / sqrt(2)) / 2. erfc of Numerical
+  // Recipes (erfcc), relative error < 1.2e-7 at both tails.
+  static inline __m512 gelu_erf_ps(__m512 x) {
+    __m512 z = _mm512_mul_ps(_mm512_abs_ps(x), _mm512_set1_ps(0.70710678f));
+    __m512 t = _mm512_div_ps(_mm512_set1_ps(1.0f),
+        _mm512_fmadd_ps(z, _mm512_set1_ps(0.5f), _mm512_set1_ps(1.0f)));
+    __m512 p = _mm512_set1_ps(0.17087277f);
+    p = fmadd(p, t, -0.82215223f);
+    p = fmadd(p, t, 1.48851587f);
+    p = fmadd(p, t, -1.13520398f);
+    p = fmadd(p, t, 0.27886807f);
+    p = fmadd(p, t, -0.18628806f);
+    p = fmadd(p, t, 0.09678418f);
+    p = fmadd(p, t, 0.37409196f);
+    p = fmadd(p, t, 1.00002368f);
+    p = fmadd(p, t, -1.26551223f);
+    // p - z^2, z^2 = x^2 / 2 in double-float to keep tails accurate
+    __m512 h = _mm512_mul_ps(x, x);
+    __m512 l = _mm512_fmsub_ps(x, x, h);
+    __m512 half = _mm512_set1_ps(0.5f);
+    p = _mm512_fnmadd_ps(h, half, p);
+    p = _mm512_fnmadd_ps(l, half, p);
+    // half of erfc(|x| / sqrt(2))
+    __m512 e = _mm512_mul_ps(_mm512_mul_ps(t, exp_ps(p)),
+                             _mm512_set1_ps(0.5f));
+    __mmask16 neg = _mm512_cmp_ps_mask(x, _mm512_setzero_ps(), _CMP_LT_OQ);
+    __m512 phi = _mm512_mask_blend_ps(
+        neg, _mm512_sub_ps(_mm512_set1_ps(1.0f), e), e);
+    return _mm512_mul_ps(x, phi);
+  }
+
+  // alg: ACT_*
+  static inline __m512 compute(int alg, float alpha, float beta, __m512 x) {
+    switch (alg) {
+    case ACT_RELU:
+      return _mm512_max_ps(x, _mm512_setzero_ps());
+    case ACT_LEAKY_RELU: {
+      __mmask16 neg = _mm512_cmp_ps_mask(x, _mm512_setzero_ps(), _CMP_LT_OQ);
+      return _mm512_mask_mul_ps(x, neg, x, _mm512_set1_ps(alpha));
+    }
+    case ACT_CLIP:
+      return _mm512_min_ps(_mm512_max_ps(x, _mm512_set1_ps(alpha)),
+                           _mm512_set1_ps(beta));
+    case ACT_SIGMOID:
+      return sigmoid_ps(x);
+    case ACT_SWISH:
+      return _mm512_mul_ps(
+          x, sigmoid_ps(_mm512_mul_ps(x, _mm512_set1_ps(alpha))));
+    case ACT_GELU_TANH: {
+      // 0.5 * x * (1 + tanh(u)) = x * sigmoid(2 * u),
+      // u = sqrt(2 / pi) * (x + 0.044715 * x^3)
+      __m512 x3 = _mm512_mul_ps(_mm512_mul_ps(x, x), x);
+      __m512 u = _mm512_fmadd_ps(x3, _mm512_set1_ps(0.044715f), x);
+      return _mm512_mul_ps(
+          x, sigmoid_ps(_mm512_mul_ps(u, _mm512_set1_ps(1.59576912f))));
+    }
+    case ACT_GELU_ERF:
+      return gelu_erf_ps(x);
+    default:
+      return x;
+    }
+  }
+};
+#endif
+
+} // namespace euler
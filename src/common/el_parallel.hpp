@@ -1,6 +1,8 @@
 #pragma once
 
 #include <omp.h>
+#include <atomic>
+#include <immintrin.h>
 #include <type_traits>
 #include <cstdlib>
 #include <cassert>
@@ -117,3 +119,46 @@ static inline void parallel_for(int mthr, Args... args)
     thread_parallel_for<N, M>(mthr, ithr, args...);
   }
 }
+
+// Turns of K-split partials of output tiles: slice s of a tile adds its
+// partial to the output after slice s - 1, lock free and in slice order
+// (deterministic sums). Turns count on across runs, no reset.
+//
+// Tasks of slice s - 1 must come first in the task order of each thread,
+// i.e. slices as the outermost loop of thread_parallel_for, so the task
+// a thread waits for is never behind it.
+struct ksplit_turns_t {
+  ksplit_turns_t() : turns_(nullptr), slices_(1), base_(0) {}
+  ~ksplit_turns_t() { delete[] turns_; }
+
+  void setup(int ntiles, int slices)
+  {
+    delete[] turns_;
+    turns_ = new std::atomic<unsigned>[ntiles];
+    for (int i = 0; i < ntiles; ++i)
+      turns_[i].store(0, std::memory_order_relaxed);
+    slices_ = slices;
+    base_ = 0u - slices_;
+  }
+
+  // Called by the master before the parallel region of each run
+  inline void begin_run() { base_ += slices_; }
+
+  inline void wait(int tile, int slice)
+  {
+    unsigned turn = base_ + slice;
+    while (turns_[tile].load(std::memory_order_acquire) != turn)
+      _mm_pause();
+  }
+
+  // Streaming stores of the partial are fenced before the pass
+  inline void pass(int tile, int slice)
+  {
+    _mm_sfence();
+    turns_[tile].store(base_ + slice + 1, std::memory_order_release);
+  }
+
+  private:
+  std::atomic<unsigned> *turns_;
+  unsigned slices_, base_;
+};
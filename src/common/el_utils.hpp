@@ -204,6 +204,7 @@ static inline const char *algorithm_to_string(int alg) {
     case CONV_DIRECT_VMG: return "direct_conv_vmg";
     case CONV_WINOGRAD: return "winograd_conv";
     case DECONV_DIRECT: return "deconv";
+    case DECONV_SUBPIXEL: return "deconv_subpixel";
     default: return "unknown"; break;
   }
   return "unknown";
@@ -1,11 +1,13 @@
 #include <stdlib.h>
 #include <assert.h>
 #include <float.h>
+#include <math.h>
 #include "euler.hpp"
 #include "el_def.hpp"
 #include "el_isa.hpp"
 #include "el_utils.hpp"
 #include "elx_conv.hpp"
+#include "elx_calib.hpp"
 #include "elx_conv_wino.hpp"
 #include "elx_conv_wino_lp.hpp"
 #include "elx_conv_direct_1x1.hpp"
@@ -13,8 +15,11 @@
 #include "elx_conv_direct.hpp"
 #include "elx_conv_direct_vmg.hpp"
 #include "elx_conv_direct_lp.hpp"
+#include "elx_conv_direct_depthwise.hpp"
 #include "elx_conv_direct_depthwise_lp.hpp"
 #include "elx_deconv_direct.hpp"
+#include "elx_deconv_direct_lp.hpp"
+#include "elx_deconv_subpixel.hpp"
 
 namespace euler {
 
@@ -43,6 +48,15 @@ eld_conv_t::eld_conv_t()
   format_as_blocked = { false, false, false };
   input_quant = {EL_NO_CALI, EL_NO_CALI};
   output_quant = {EL_NO_CALI, EL_NO_CALI};
+  output_quant_oc = {nullptr, nullptr};
+  observe = false;
+  with_pool = false;
+  pool = { POOL_MAX, 2, 2, 2, 2, 0, 0 };
+  affine = {nullptr, nullptr};
+  activation = {ACT_RELU, 0.0f, 0.0f};
+  input_view = {0, 0, 0, 0, 0, 0};
+  output_view = {0, 0, 0, 0, 0, 0};
+  input_prepadded = false;
   sampling_kind = FINE;
   eager_mode = true;
   stream_sync = false;
@@ -64,6 +78,9 @@ int eld_conv_t::setup(bool fully_setup)
   const int oc = dims.oc / g;
 
   bool depthwise = (g == dims.ic && g == dims.oc);
+  // FP32 depthwise kernels: kw 3..7, stride w 1|2
+  bool depthwise_direct = depthwise && dims.kw >= 3 && dims.kw <= 7
+      && strides.w <= 2;
 
   if (V != 16) {
     // TODO: V == 8
@@ -95,16 +112,93 @@ int eld_conv_t::setup(bool fully_setup)
   uint32_t user_type_f16 = dt{ { { f16, f16, f16, f16 } } }.flat;
 #endif
 
-  sizes.input = dims.n * dims.ih * dims.iw *
-      (estl::any_of(formats.input, nChw16c, nChw8c) ? ALIGNUP(dims.ic, V)
-                                                    : dims.ic);
+  if (observe && (user_type != user_type_f32 || !eager_mode)) {
+    el_error("Observe mode: FP32 and eager mode only");
+    return ELD_UNIMPLEMENTED;
+  }
+
   sizes.weights = dims.g * dims.kh * dims.kw *
     (estl::any_of(formats.weights, OIhw16i16o, OIhw8i8o, gOIhw16i16o, gOIhw8i8o)
                            ? ALIGNUP(ic, V) * ALIGNUP(oc, V)
                            : oc * ic) + 4 * V; // for weights pipeline
-  sizes.output = dims.n * dims.oh * dims.ow *
-      (estl::any_of(formats.output, nChw16c, nChw8c) ? ALIGNUP(dims.oc, V)
-                                                     : dims.oc);
+  if (with_relu && activation.alg != ACT_RELU) {
+    if (activation.alg < ACT_RELU || activation.alg > ACT_GELU_ERF) {
+      el_error("Activation: algorithm not supported");
+      return ELD_GENERAL_ERROR;
+    }
+    if (output_quant_oc.scale != nullptr) {
+      el_error("Activation: per-oc output quantization supports ReLU only");
+      return ELD_UNIMPLEMENTED;
+    }
+  }
+
+  if (affine.scale != nullptr && data_type.weights != f32) {
+    el_error("Affine epilogue: FP32 weights only");
+    return ELD_UNIMPLEMENTED;
+  }
+
+  if (with_pool) {
+    if (user_type != user_type_f32 || with_ip_sum || observe
+        || algorithm == DECONV_DIRECT || algorithm == DECONV_SUBPIXEL) {
+      el_error("Pooling: FP32 conv without inplace sum/observe only");
+      return ELD_UNIMPLEMENTED;
+    }
+    if (!estl::any_of(pool.alg, POOL_MAX, POOL_AVG) || pool.kh < 1
+        || pool.kw < 1 || pool.sh < 1 || pool.sw < 1 || pool.kh > dims.oh
+        || pool.kw > dims.ow) {
+      el_error("Pooling parameter error");
+      return ELD_GENERAL_ERROR;
+    }
+    pool.oh = (dims.oh - pool.kh) / pool.sh + 1;
+    pool.ow = (dims.ow - pool.kw) / pool.sw + 1;
+  }
+
+  // Views: user tensors of view c x h x w, 0 for dims
+  const int OH = with_pool ? pool.oh : dims.oh;
+  const int OW = with_pool ? pool.ow : dims.ow;
+  auto view_dims = [](decltype(input_view) v, int C, int H, int W) {
+    if (v.c == 0) { v.c = C; v.c_off = 0; }
+    if (v.h == 0) { v.h = H; v.h_off = 0; }
+    if (v.w == 0) { v.w = W; v.w_off = 0; }
+    return v;
+  };
+  auto view_error = [&](int fmt, decltype(input_view) &v, int C, int H,
+                        int W) {
+    if (!estl::any_of(fmt, nchw, nhwc, nChw16c) || v.c_off < 0
+        || v.h_off < 0 || v.w_off < 0 || v.c < v.c_off + C
+        || v.h < v.h_off + H || v.w < v.w_off + W)
+      return true;
+    return fmt == nChw16c
+        && (v.c_off % V != 0 || (C % V != 0 && v.c_off + C != v.c));
+  };
+  // Pre-padded input: input tensor with the halo
+  const int IH = input_prepadded ? dims.ih + pads.t + pads.b : dims.ih;
+  const int IW = input_prepadded ? dims.iw + pads.l + pads.r : dims.iw;
+  auto iv = view_dims(input_view, dims.ic, IH, IW);
+  auto ov = view_dims(output_view, dims.oc, OH, OW);
+  bool with_input_view = iv.c != dims.ic || iv.h != IH || iv.w != IW;
+  bool with_output_view = ov.c != dims.oc || ov.h != OH || ov.w != OW;
+  if (with_input_view || with_output_view) {
+    if (observe || algorithm == DECONV_DIRECT
+        || algorithm == DECONV_SUBPIXEL) {
+      el_error("Tensor view: conv without observe only");
+      return ELD_UNIMPLEMENTED;
+    }
+    if ((with_input_view
+         && view_error(formats.input, iv, dims.ic, IH, IW))
+        || (with_output_view
+            && view_error(formats.output, ov, dims.oc, OH, OW))) {
+      el_error("Tensor view parameter error");
+      return ELD_GENERAL_ERROR;
+    }
+  }
+
+  sizes.input = dims.n * iv.h * iv.w *
+      (estl::any_of(formats.input, nChw16c, nChw8c) ? ALIGNUP(iv.c, V)
+                                                    : iv.c);
+  sizes.output = dims.n * ov.h * ov.w *
+      (estl::any_of(formats.output, nChw16c, nChw8c) ? ALIGNUP(ov.c, V)
+                                                     : ov.c);
   sizes.bias = estl::any_of(formats.output, nChw16c, nChw8c)
                    ? ALIGNUP(dims.oc, V)
                    : dims.oc;
@@ -126,12 +220,14 @@ int eld_conv_t::setup(bool fully_setup)
 
   // Validate padding
   int oh, ow;
-  if (algorithm == DECONV_DIRECT) {
+  if (algorithm == DECONV_DIRECT || algorithm == DECONV_SUBPIXEL) {
     oh = (dims.ih - 1) * strides.h + dims.kh - pads.t - pads.b;
     ow = (dims.iw - 1) * strides.w + dims.kw - pads.l - pads.r;
   } else { // CONV
-    oh = (dims.ih + pads.t + pads.b - dims.kh) / strides.h + 1;
-    ow = (dims.iw + pads.l + pads.r - dims.kw) / strides.w + 1;
+    oh = (dims.ih + pads.t + pads.b - (dims.kh - 1) * dilations.h - 1)
+        / strides.h + 1;
+    ow = (dims.iw + pads.l + pads.r - (dims.kw - 1) * dilations.w - 1)
+        / strides.w + 1;
   }
   if (oh != dims.oh || ow != dims.ow) {
     el_error("Padding parameter error");
@@ -158,13 +254,40 @@ int eld_conv_t::setup(bool fully_setup)
     }
   }
 
+  // Sub-pixel deconv skips the zeros inserted by strides
+  if (algorithm == DECONV_DIRECT && !disable_autoparam &&
+      user_type == user_type_f32 && (strides.h > 1 || strides.w > 1)) {
+    algorithm = DECONV_SUBPIXEL;
+  }
+
+  // Blocked group conv with groups narrower than V packs groups in vectors
+  if (algorithm == CONV_DIRECT && !disable_autoparam &&
+      user_type == user_type_f32 && g > 1 && (ic % V != 0 || oc % V != 0) &&
+      !depthwise_direct && formats.input != nhwc && formats.output != nhwc &&
+      !input_prepadded) {
+    algorithm = CONV_DIRECT_VMG;
+  }
+
+  // Kernels of standard padding only cannot run on pre-padded input
+  if (input_prepadded && (!estl::any_of(algorithm, CONV_DIRECT,
+      CONV_DIRECT_1X1, CONV_WINOGRAD) || (depthwise
+      && user_type != user_type_f32))) {
+    el_error("Pre-padded input: direct, 1x1 and Winograd conv only");
+    return ELD_UNIMPLEMENTED;
+  }
+
   if (!fully_setup) {
     return ELD_OK;
   }
 
   // Direct
   if (algorithm == CONV_DIRECT) {
-    if (user_type == user_type_f32) {
+    if (user_type == user_type_f32 && depthwise_direct) {
+      if (f16c_opt)
+        xc = new elx_conv_direct_depthwise_t<conv::FP32, conv_impl::FP32_F16w, 16, ISA_SKX_AVX512>(*this);
+      else
+        xc = new elx_conv_direct_depthwise_t<conv::FP32, conv_impl::FP32, 16, ISA_SKX_AVX512>(*this);
+    } else if (user_type == user_type_f32) {
       if (f16c_opt)
         xc = new elx_conv_direct_t<conv::FP32, conv_impl::FP32_F16w, 16, ISA_SKX_AVX512>(*this);
       else
@@ -225,13 +348,6 @@ int eld_conv_t::setup(bool fully_setup)
       return ELD_UNIMPLEMENTED;
     }
 
-    if ((user_type == user_type_u8f32u8f32 ||
-        user_type == user_type_u8f32s8f32 ||
-        user_type == user_type_u8f32f32f32) &&
-        input_quant.z != 0) {
-      el_error("Support abs-max scaling for input only in Conv Winograd ...");
-    }
-
     if (tile_size == 0) {
       int t = dims.n * ((dims.oh + 3) / 4) * ((dims.ow + 3) / 4);
       float mac_per_read = (t * ALIGNUP(oc, 16)) * 1.0f / (t + ALIGNUP(oc, V));
@@ -268,7 +384,12 @@ int eld_conv_t::setup(bool fully_setup)
         break; \
       }
 
-    if (!disable_autoparam) f16c_opt = true;
+    // Observe mode records fp32 transformed input
+    if (!disable_autoparam && !observe) f16c_opt = true;
+    if (observe && f16c_opt) {
+      el_error("Observe mode: f16c_opt not supported in Conv Winograd");
+      return ELD_UNIMPLEMENTED;
+    }
 
     // User int8
     if (user_type == user_type_u8f32u8f32) {
@@ -311,8 +432,92 @@ int eld_conv_t::setup(bool fully_setup)
   } else if (algorithm == DECONV_DIRECT) {
     if (user_type == user_type_f32) {
       xc = new elx_deconv_direct_t<conv::FP32, conv_impl::FP32, 16, ISA_SKX_AVX512>(*this);
+    } else if (user_type == user_type_u8f32u8f32) {
+      xc = new elx_deconv_direct_lp_t<conv::U8F32U8F32, conv_impl::INT8_F32, 16, ISA_SKX_AVX512>(*this);
+    } else if (user_type == user_type_u8f32s8f32) {
+      xc = new elx_deconv_direct_lp_t<conv::U8F32S8F32, conv_impl::INT8_F32, 16, ISA_SKX_AVX512>(*this);
+    } else if (user_type == user_type_u8f32f32f32) {
+      xc = new elx_deconv_direct_lp_t<conv::U8F32F32F32, conv_impl::INT8_F32, 16, ISA_SKX_AVX512>(*this);
     } else
       el_error("TODO: FP16 UserTypes for DECONV_DIRECT.");
+  } else if (algorithm == DECONV_SUBPIXEL) {
+    if (user_type == user_type_f32) {
+      xc = new elx_deconv_subpixel_t<conv::FP32, conv_impl::FP32, 16, ISA_SKX_AVX512>(*this);
+    } else
+      el_error("TODO: non-FP32 UserTypes for DECONV_SUBPIXEL.");
+  }
+
+  return ELD_OK;
+}
+
+// A_fp32 = scale * (A_quant - z), 7-bit precision as used by int8 kernels.
+// Abs-max scaling for signed quant type or non-negative range.
+static void calib_quant(float lo, float hi, bool is_signed, float &scale, float &z)
+{
+  const float eps = 0.000001f;
+  if (is_signed || lo >= 0.0f) {
+    scale = (estl::max(-lo, hi) + eps) / 127.0f;
+    z = 0.0f;
+  } else {
+    scale = (hi - lo + eps) / 127.0f;
+    z = -lo / scale;
+  }
+}
+
+void eld_conv_t::fold_batch_norm(float *scale, float *shift,
+    const float *mean, const float *var, const float *gamma,
+    const float *beta, float eps)
+{
+  iter_each (_oc, dims.oc) {
+    scale[_oc] = (gamma == nullptr ? 1.0f : gamma[_oc])
+        / sqrtf(var[_oc] + eps);
+    shift[_oc] = (beta == nullptr ? 0.0f : beta[_oc]) - mean[_oc] * scale[_oc];
+  }
+  affine = {scale, shift};
+}
+
+int eld_conv_t::calibrate(eld_conv_t &q, int method, float percentile)
+{
+  if (xc == nullptr || xc->calib == nullptr || xc->calib->input.empty()) {
+    el_error("Calibrate: no statistics, run elx_conv in observe mode first");
+    return ELD_GENERAL_ERROR;
+  }
+  elx_calib_t *calib = xc->calib;
+  float lo, hi;
+
+  // u8 input: abs-max, or shifted by 128 for signed data
+  calib->input.range(method, percentile, lo, hi);
+  q.input_quant.scale = (estl::max(-lo, hi) + 0.000001f) / 127.0f;
+  q.input_quant.z = lo < 0.0f ? 128.0f : 0.0f;
+
+  if (!calib->tinput.empty()) {
+    calib->tinput.range(method, percentile, lo, hi);
+    calib_quant(lo, hi, false,
+        q.wino_tinput_quant.scale, q.wino_tinput_quant.z);
+  }
+
+  if (q.data_type.output == u8 || q.data_type.output == s8) {
+    bool is_signed = q.data_type.output == s8;
+    calib->output.range(method, percentile, lo, hi);
+    calib_quant(lo, hi, is_signed, q.output_quant.scale, q.output_quant.z);
+
+    // Per output channel from channel min/max
+    if (q.output_quant_oc.scale != nullptr) {
+      auto &stats = calib->output;
+      if (q.dims.oc != (int)stats.cmin.size()) {
+        el_error("Calibrate: output channels mismatch");
+        return ELD_GENERAL_ERROR;
+      }
+      iter_each (_oc, q.dims.oc) {
+        float z;
+        calib_quant(estl::min(stats.cmin[_oc], 0.0f),
+            estl::max(stats.cmax[_oc], 0.0f),
+            is_signed || q.output_quant_oc.z == nullptr,
+            q.output_quant_oc.scale[_oc], z);
+        if (q.output_quant_oc.z != nullptr)
+          q.output_quant_oc.z[_oc] = z;
+      }
+    }
   }
 
   return ELD_OK;
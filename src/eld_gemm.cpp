@@ -0,0 +1,114 @@
+#include <stdlib.h>
+#include "euler.hpp"
+#include "el_def.hpp"
+#include "el_isa.hpp"
+#include "el_utils.hpp"
+#include "elx_gemm.hpp"
+
+namespace euler {
+
+eld_gemm_t::eld_gemm_t()
+{
+  dims = { 0, 0, 0, 1 };
+  trans = { false, false };
+  ld = { 0, 0, 0 };
+  batch_stride = { 0, 0, 0 };
+  data_type = { f32, f32, f32, f32 };
+  a_quant = { EL_NO_CALI, EL_NO_CALI };
+  c_quant = { EL_NO_CALI, EL_NO_CALI };
+  with_bias = false;
+  with_sum = false;
+  with_relu = false;
+  activation = { ACT_RELU, 0.0f, 0.0f };
+  blocking = { 0, 0, 0 };
+  nthreads = 0;
+  xg = nullptr;
+}
+
+eld_gemm_t::~eld_gemm_t()
+{
+  if (xg != nullptr) {
+    delete xg;
+  }
+}
+
+int eld_gemm_t::setup()
+{
+  const int V = cpu_vector_length() / 4;
+  if (V != 16) {
+    el_error("CPU vector not support");
+  }
+
+  if (dims.m <= 0 || dims.n <= 0 || dims.k <= 0 || dims.batch <= 0) {
+    el_error("GEMM: dims error");
+    return ELD_GENERAL_ERROR;
+  }
+  if ((ld.a != 0 && ld.a < (trans.a ? dims.m : dims.k))
+      || (ld.b != 0 && ld.b < (trans.b ? dims.k : dims.n))
+      || (ld.c != 0 && ld.c < dims.n)) {
+    el_error("GEMM: leading dimension error");
+    return ELD_GENERAL_ERROR;
+  }
+
+  using dt = decltype(data_type);
+  auto same_type = [](dt a, dt b) {
+    return a.a == b.a && a.b == b.b && a.c == b.c && a.bias == b.bias;
+  };
+  bool is_f32 = same_type(data_type, dt{ f32, f32, f32, f32 });
+  bool is_int8 = same_type(data_type, dt{ u8, f32, u8, f32 })
+      || same_type(data_type, dt{ u8, f32, s8, f32 });
+  if (!is_f32 && !is_int8) {
+    el_error("GEMM: data type not supported");
+    return ELD_UNIMPLEMENTED;
+  }
+  if (is_int8) {
+    if (batch_stride.b != 0) {
+      el_error("GEMM: INT8: B per matrix unimplemented");
+      return ELD_UNIMPLEMENTED;
+    }
+    if (dims.k % V != 0 || dims.n % V != 0) {
+      el_error("GEMM: INT8: k and n of 16x only");
+      return ELD_UNIMPLEMENTED;
+    }
+    if (a_quant.scale == EL_NO_CALI || c_quant.scale == EL_NO_CALI) {
+      el_error("GEMM: INT8: quantization of A and C required");
+      return ELD_GENERAL_ERROR;
+    }
+  }
+
+  if (xg != nullptr)
+    delete xg;
+  xg = new elx_gemm_t(*this);
+
+  return ELD_OK;
+}
+
+eld_ip_t::eld_ip_t()
+{
+  dims = { 0, 0, 0 };
+  data_type = { f32, f32, f32, f32 };
+  input_quant = { EL_NO_CALI, EL_NO_CALI };
+  output_quant = { EL_NO_CALI, EL_NO_CALI };
+  with_bias = false;
+  with_relu = false;
+  activation = { ACT_RELU, 0.0f, 0.0f };
+  nthreads = 0;
+}
+
+// Batch rows of input by rows of weights, k-contiguous both
+int eld_ip_t::setup()
+{
+  gemm.dims = { dims.n, dims.oc, dims.ic, 1 };
+  gemm.trans = { false, true };
+  gemm.data_type = { data_type.input, data_type.weights, data_type.output,
+                     data_type.bias };
+  gemm.a_quant = { input_quant.scale, input_quant.z };
+  gemm.c_quant = { output_quant.scale, output_quant.z };
+  gemm.with_bias = with_bias;
+  gemm.with_relu = with_relu;
+  gemm.activation = { activation.alg, activation.alpha, activation.beta };
+  gemm.nthreads = nthreads;
+  return gemm.setup();
+}
+
+}  // namespace euler
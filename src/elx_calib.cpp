@@ -0,0 +1,254 @@
+#include <math.h>
+#include <float.h>
+#include "el_def.hpp"
+#include "el_utils.hpp"
+#include "el_stl.hpp"
+#include "elx_calib.hpp"
+
+namespace euler {
+
+elx_calib_stats_t::elx_calib_stats_t()
+    : min(FLT_MAX), max(-FLT_MAX), hist(nbins, 0.0), hist_lo(0.0f),
+      hist_hi(0.0f), count(0.0)
+{
+}
+
+static inline int __bin(float v, float lo, float hi, int nbins)
+{
+  if (hi <= lo) return 0;
+  int b = (int)((v - lo) / (hi - lo) * nbins);
+  return b < 0 ? 0 : b >= nbins ? nbins - 1 : b;
+}
+
+void elx_calib_stats_t::extend(float lo, float hi)
+{
+  if (min > max) {
+    min = hist_lo = lo;
+    max = hist_hi = hi;
+    return;
+  }
+  min = estl::min(min, lo);
+  max = estl::max(max, hi);
+  if (lo >= hist_lo && hi <= hist_hi)
+    return;
+
+  // Re-bin with the centers of the old bins
+  float new_lo = estl::min(lo, hist_lo);
+  float new_hi = estl::max(hi, hist_hi);
+  float w = (hist_hi - hist_lo) / nbins;
+  std::vector<double> h(nbins, 0.0);
+  iter_each (_b, nbins) {
+    if (hist[_b] == 0.0) continue;
+    h[__bin(hist_lo + (_b + 0.5f) * w, new_lo, new_hi, nbins)] += hist[_b];
+  }
+  hist.swap(h);
+  hist_lo = new_lo;
+  hist_hi = new_hi;
+}
+
+void elx_calib_stats_t::accumulate(float *data, size_t size, double *h) const
+{
+  for (size_t i = 0; i < size; i++)
+    h[__bin(data[i], hist_lo, hist_hi, nbins)] += 1.0;
+}
+
+void elx_calib_stats_t::merge(double *h)
+{
+  iter_each (_b, nbins) {
+    hist[_b] += h[_b];
+    count += h[_b];
+  }
+}
+
+void elx_calib_stats_t::update(float *data, size_t size)
+{
+  float lo = FLT_MAX, hi = -FLT_MAX;
+#pragma omp parallel for reduction(min:lo) reduction(max:hi)
+  for (size_t i = 0; i < size; i++) {
+    lo = estl::min(lo, data[i]);
+    hi = estl::max(hi, data[i]);
+  }
+  if (size == 0) return;
+  extend(lo, hi);
+
+#pragma omp parallel
+  {
+    std::vector<double> h(nbins, 0.0);
+    size_t nthr = omp_get_num_threads(), ithr = omp_get_thread_num();
+    size_t chunk = (size + nthr - 1) / nthr;
+    size_t start = estl::min(size, ithr * chunk);
+    size_t end = estl::min(size, start + chunk);
+    accumulate(&data[start], end - start, h.data());
+#pragma omp critical
+    merge(h.data());
+  }
+}
+
+void elx_calib_stats_t::update(float *data, int n, int c, int hw, int fmt)
+{
+  if (fmt != nchw && fmt != nhwc && fmt != nChw16c) {
+    el_error("Observe: unsupported activation format");
+    return;
+  }
+  if (cmin.empty()) {
+    cmin.assign(c, FLT_MAX);
+    cmax.assign(c, -FLT_MAX);
+  }
+
+  // Channel _c of image _n: hw elements at stride
+  const int C16 = (c + 15) / 16;
+  auto channel = [&](int _n, int _c, int &stride) {
+    if (fmt == nchw) {
+      stride = 1;
+      return &data[((size_t)_n * c + _c) * hw];
+    } else if (fmt == nhwc) {
+      stride = c;
+      return &data[(size_t)_n * hw * c + _c];
+    } else {
+      stride = 16;
+      return &data[((size_t)_n * C16 + _c / 16) * hw * 16 + _c % 16];
+    }
+  };
+
+  float lo = FLT_MAX, hi = -FLT_MAX;
+#pragma omp parallel for reduction(min:lo) reduction(max:hi)
+  for (int _c = 0; _c < c; _c++) {
+    float l = cmin[_c], h = cmax[_c];
+    iter_each (_n, n) {
+      int stride;
+      float *p = channel(_n, _c, stride);
+      iter_each (_hw, hw) {
+        l = estl::min(l, p[(size_t)_hw * stride]);
+        h = estl::max(h, p[(size_t)_hw * stride]);
+      }
+    }
+    cmin[_c] = l;
+    cmax[_c] = h;
+    lo = estl::min(lo, l);
+    hi = estl::max(hi, h);
+  }
+  extend(lo, hi);
+
+#pragma omp parallel
+  {
+    std::vector<double> h(nbins, 0.0);
+#pragma omp for nowait
+    for (int _c = 0; _c < c; _c++) {
+      iter_each (_n, n) {
+        int stride;
+        float *p = channel(_n, _c, stride);
+        iter_each (_hw, hw)
+          h[__bin(p[(size_t)_hw * stride], hist_lo, hist_hi, nbins)] += 1.0;
+      }
+    }
+#pragma omp critical
+    merge(h.data());
+  }
+}
+
+// Symmetric threshold minimizing KL divergence between the |x| histogram
+// and its 128-level quantized version (TensorRT entropy calibration)
+void elx_calib_stats_t::kl_threshold(float &lo, float &hi) const
+{
+  const int target = 128;
+  float amax = estl::max(fabsf(hist_lo), fabsf(hist_hi));
+  float w = (hist_hi - hist_lo) / nbins;
+  std::vector<double> ahist(nbins, 0.0);
+  iter_each (_b, nbins) {
+    float center = fabsf(hist_lo + (_b + 0.5f) * w);
+    ahist[__bin(center, 0.0f, amax, nbins)] += hist[_b];
+  }
+
+  int best = nbins;
+  double best_kl = DBL_MAX;
+  std::vector<double> p(nbins), q(nbins);
+  double outliers = count;
+  iter_each (_b, target) outliers -= ahist[_b];
+
+  for (int i = target; i <= nbins; i++) {
+    // Reference distribution, outliers clipped into the last bin
+    double psum = 0.0;
+    iter_each (_b, i) {
+      p[_b] = ahist[_b];
+      psum += p[_b];
+    }
+    p[i - 1] += outliers;
+    psum += outliers;
+    if (i < nbins) outliers -= ahist[i];
+
+    // Quantize to target levels and expand over non-zero bins
+    double qsum = 0.0;
+    iter_each (_k, target) {
+      int start = (int)((double)_k * i / target);
+      int end = _k == target - 1 ? i : (int)((double)(_k + 1) * i / target);
+      double sum = 0.0;
+      int nz = 0;
+      for (int _b = start; _b < end; _b++) {
+        sum += ahist[_b];
+        nz += ahist[_b] != 0.0;
+      }
+      for (int _b = start; _b < end; _b++) {
+        q[_b] = (nz == 0 || ahist[_b] == 0.0) ? 0.0 : sum / nz;
+        qsum += q[_b];
+      }
+    }
+    if (psum == 0.0 || qsum == 0.0) continue;
+
+    double kl = 0.0;
+    iter_each (_b, i) {
+      if (p[_b] == 0.0) continue;
+      double pn = p[_b] / psum;
+      double qn = q[_b] == 0.0 ? 1e-10 : q[_b] / qsum;
+      kl += pn * log(pn / qn);
+    }
+    if (kl < best_kl) {
+      best_kl = kl;
+      best = i;
+    }
+  }
+
+  float threshold = amax * best / nbins;
+  lo = estl::max(min, -threshold);
+  hi = estl::min(max, threshold);
+}
+
+void elx_calib_stats_t::range(
+    int method, float percentile, float &lo, float &hi) const
+{
+  if (empty()) {
+    lo = hi = 0.0f;
+    return;
+  }
+
+  lo = min;
+  hi = max;
+  if (method == CALIB_PERCENTILE) {
+    // Clip (100 - percentile)% of samples at each tail
+    double tail = count * (100.0 - percentile) / 100.0;
+    float w = (hist_hi - hist_lo) / nbins;
+    double sum = 0.0;
+    iter_each (_b, nbins) {
+      sum += hist[_b];
+      if (sum > tail) {
+        lo = estl::max(min, hist_lo + _b * w);
+        break;
+      }
+    }
+    sum = 0.0;
+    for (int _b = nbins - 1; _b >= 0; _b--) {
+      sum += hist[_b];
+      if (sum > tail) {
+        hi = estl::min(max, hist_lo + (_b + 1) * w);
+        break;
+      }
+    }
+  } else if (method == CALIB_KL) {
+    kl_threshold(lo, hi);
+  }
+
+  // Zero must be representable for padding
+  lo = estl::min(lo, 0.0f);
+  hi = estl::max(hi, 0.0f);
+}
+
+}  // namespace euler
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <vector>
+#include "euler.hpp"
+
+namespace euler {
+
+// Running statistics of a FP32 activation: per-layer min/max and
+// histogram, optional per-channel min/max.
+struct elx_calib_stats_t {
+  // histogram bins over [hist_lo, hist_hi]
+  constexpr static int nbins = 2048;
+
+  elx_calib_stats_t();
+
+  // Plain buffer, per-layer statistics only
+  void update(float *data, size_t size);
+  // Activation of n, c, hw in nchw | nhwc | nChw16c, per-channel also
+  void update(float *data, int n, int c, int hw, int fmt);
+
+  // Two-pass update for data produced on the fly: extend() the histogram
+  // range with the min/max of the data, then accumulate() into a private
+  // histogram of nbins and merge() it.
+  void extend(float lo, float hi);
+  void accumulate(float *data, size_t size, double *hist) const;
+  void merge(double *hist);
+
+  // Quantization range [lo, hi] by CALIB_MINMAX | CALIB_PERCENTILE | CALIB_KL
+  void range(int method, float percentile, float &lo, float &hi) const;
+
+  bool empty() const { return count == 0; }
+
+  float min, max;
+  std::vector<float> cmin, cmax;
+  std::vector<double> hist;
+  float hist_lo, hist_hi;
+  double count;
+
+private:
+  void kl_threshold(float &lo, float &hi) const;
+};
+
+struct elx_calib_t {
+  elx_calib_stats_t input, tinput, output;
+};
+
+}  // namespace euler
@@ -1,5 +1,6 @@
 #include <assert.h>
 #include <string.h>
+#include <float.h>
 #include <chrono>
 #include "euler.hpp"
 #include "el_stl.hpp"
@@ -14,20 +15,106 @@
 
 namespace euler {
 
+// Element size of data type dt
+static inline size_t elem_size(uint8_t dt)
+{
+  return dt == f32 ? sizeof(float) : dt == f16 ? sizeof(short)
+                                               : sizeof(uint8_t);
+}
+
+// Image _n of view tensor t
+static inline char *view_image(void *t, int fmt,
+    decltype(eld_conv_t::input_view) &v, int _n, size_t esize)
+{
+  size_t C = fmt == nChw16c ? ALIGNUP(v.c, 16) : v.c;
+  return (char *)t + _n * C * v.h * v.w * esize;
+}
+
+// Byte offset of channel region c_off in image of view tensor, zero copy
+// views only: nchw/nChw16c of view h/w of dims
+static inline size_t view_offset(int fmt,
+    decltype(eld_conv_t::input_view) &v, size_t esize)
+{
+  return (size_t)v.c_off * v.h * v.w * esize;
+}
+
+// Copy between dense image of C channels, H x W and its region in image
+// of view tensor. to_view: dense to view.
+static void copy_view(char *view, char *dense, int fmt,
+    decltype(eld_conv_t::input_view) &v, int C, int H, int W,
+    size_t esize, bool to_view)
+{
+  auto copy = [&](char *vp, char *dp, size_t len) {
+    if (to_view)
+      memcpy(vp, dp, len * esize);
+    else
+      memcpy(dp, vp, len * esize);
+  };
+
+  if (fmt == nhwc) {
+#pragma omp parallel for collapse(2)
+    iter_each (_h, H) {
+      iter_each (_w, W) {
+        size_t vi = ((size_t)(v.h_off + _h) * v.w + v.w_off + _w) * v.c
+            + v.c_off;
+        size_t di = ((size_t)_h * W + _w) * C;
+        copy(view + vi * esize, dense + di * esize, C);
+      }
+    }
+    return;
+  }
+
+  // nchw/nChw16c: rows of W pixels of L channels
+  const int L = fmt == nChw16c ? 16 : 1;
+  const int C2 = ALIGNUP(C, L) / L;
+#pragma omp parallel for collapse(2)
+  iter_each (_C2, C2) {
+    iter_each (_h, H) {
+      size_t vi = (((size_t)v.c_off / L + _C2) * v.h + v.h_off + _h) * v.w
+          + v.w_off;
+      size_t di = ((size_t)_C2 * H + _h) * W;
+      copy(view + vi * L * esize, dense + di * L * esize, (size_t)W * L);
+    }
+  }
+}
+
 elx_conv_t::elx_conv_t(eld_conv_t &dc)
 {
-  this->n = dc.dims.n;
+  // Tensor views: engine of one image
+  auto view_dims = [](decltype(dc.input_view) v, int C, int H, int W) {
+    if (v.c == 0) { v.c = C; v.c_off = 0; }
+    if (v.h == 0) { v.h = H; v.h_off = 0; }
+    if (v.w == 0) { v.w = W; v.w_off = 0; }
+    return v;
+  };
+  // Pre-padded input: conv without padding on the input and its halo
+  const int IH = dc.input_prepadded ? dc.dims.ih + dc.pads.t + dc.pads.b
+                                    : dc.dims.ih;
+  const int IW = dc.input_prepadded ? dc.dims.iw + dc.pads.l + dc.pads.r
+                                    : dc.dims.iw;
+  const int OH = dc.with_pool ? dc.pool.oh : dc.dims.oh;
+  const int OW = dc.with_pool ? dc.pool.ow : dc.dims.ow;
+  this->input_view = view_dims(dc.input_view, dc.dims.ic, IH, IW);
+  this->output_view = view_dims(dc.output_view, dc.dims.oc, OH, OW);
+  const bool in_view = this->input_view.c != dc.dims.ic
+      || this->input_view.h != IH || this->input_view.w != IW;
+  const bool out_view = this->output_view.c != dc.dims.oc
+      || this->output_view.h != OH || this->output_view.w != OW;
+  this->with_view = in_view || out_view;
+  this->view_n = dc.dims.n;
+
+  this->n = this->with_view ? 1 : dc.dims.n;
   this->g = dc.dims.g;
   this->ic = dc.dims.ic;
   this->oc = dc.dims.oc;
-  this->ih = dc.dims.ih;
-  this->iw = dc.dims.iw;
+  this->ih = IH;
+  this->iw = IW;
   this->oh = dc.dims.oh;
   this->ow = dc.dims.ow;
   this->kh = dc.dims.kh;
   this->kw = dc.dims.kw;
-  this->lp = dc.pads.l;
-  this->tp = dc.pads.t;
+  this->lp = dc.input_prepadded ? 0 : dc.pads.l;
+  this->tp = dc.input_prepadded ? 0 : dc.pads.t;
   this->hs = dc.strides.h;
   this->ws = dc.strides.w;
   this->hd = dc.dilations.h;
@@ -44,7 +131,11 @@ elx_conv_t::elx_conv_t(eld_conv_t &dc)
   this->weights_fmt = dc.formats.weights;
   this->output_fmt = dc.formats.output;
   this->with_relu = dc.with_relu;
-  this->with_bias = dc.with_bias;
+  // affine epilogue folds shift into bias
+  this->with_bias = dc.with_bias || dc.affine.scale != nullptr;
+  this->act_alg = dc.activation.alg;
+  this->act_alpha = dc.activation.alpha;
+  this->act_beta = dc.activation.beta;
   this->with_ip_sum = dc.with_ip_sum;
   this->with_op_sum = dc.with_op_sum;
   this->with_argmax = dc.with_argmax;
@@ -52,6 +143,71 @@ elx_conv_t::elx_conv_t(eld_conv_t &dc)
   this->use_scratch_pad = dc.use_scratch_pad;
 
   this->scratch_pad = dc.scratch_pad;
+  this->calib = dc.observe ? new elx_calib_t : nullptr;
+
+  this->with_pool = dc.with_pool;
+  this->pool_alg = dc.pool.alg;
+  this->pool_kh = dc.pool.kh;
+  this->pool_kw = dc.pool.kw;
+  this->pool_sh = dc.pool.sh;
+  this->pool_sw = dc.pool.sw;
+  this->pool_c = dc.dims.oc;
+  this->pool_ih = dc.dims.oh;
+  this->pool_iw = dc.dims.ow;
+  this->pool_oh = dc.pool.oh;
+  this->pool_ow = dc.pool.ow;
+  this->pool_toutput = nullptr;
+  if (this->with_pool) {
+    size_t C = estl::any_of(dc.formats.output, nChw16c, nChw8c)
+        ? ALIGNUP(dc.dims.oc, 16) : dc.dims.oc;
+    MEMALIGN64(&this->pool_toutput,
+        sizeof(float) * this->n * dc.dims.oh * dc.dims.ow * C);
+  }
+
+  // Regions of tensor views but channel slices of nchw/nChw16c are
+  // staged in dense images
+  auto staged = [](bool is_view, int fmt, decltype(dc.input_view) &v,
+                   int H, int W) {
+    return is_view && (fmt == nhwc || v.h != H || v.w != W);
+  };
+  auto image_size = [](int fmt, int C, int H, int W) {
+    return (size_t)(fmt == nChw16c ? ALIGNUP(C, 16) : C) * H * W;
+  };
+  this->view_tinput = nullptr;
+  this->view_toutput = nullptr;
+  if (staged(in_view, dc.formats.input, this->input_view, IH, IW)) {
+    MEMALIGN64(&this->view_tinput, elem_size(dc.data_type.input)
+        * image_size(dc.formats.input, dc.dims.ic, IH, IW));
+  }
+  if (staged(out_view, dc.formats.output, this->output_view, OH, OW)) {
+    MEMALIGN64(&this->view_toutput, elem_size(dc.data_type.output)
+        * image_size(dc.formats.output, dc.dims.oc, OH, OW));
+  }
+
+  this->with_affine = dc.affine.scale != nullptr;
+  this->affine_weights = nullptr;
+  this->affine_bias = nullptr;
+  this->affine_weights_src = nullptr;
+  this->affine_bias_src = nullptr;
+  this->affine_user = { dc.dims.g, dc.dims.ic / dc.dims.g,
+      dc.dims.oc / dc.dims.g, dc.dims.kh, dc.dims.kw, dc.byte_sizes.weights,
+      dc.with_bias };
+  if (this->with_affine) {
+    if (!estl::any_of(dc.formats.weights, oihw, goihw, hwio, ghwio,
+                      OIhw16i16o, gOIhw16i16o))
+      el_error("Affine epilogue: weights format not supported");
+
+    this->affine_scale.assign(ALIGNUP(dc.dims.oc, 16), 1.0f);
+    this->affine_shift.assign(ALIGNUP(dc.dims.oc, 16), 0.0f);
+    iter_each (_oc, dc.dims.oc) {
+      this->affine_scale[_oc] = dc.affine.scale[_oc];
+      if (dc.affine.shift != nullptr)
+        this->affine_shift[_oc] = dc.affine.shift[_oc];
+    }
+    MEMALIGN64(&this->affine_weights, dc.byte_sizes.weights);
+    MEMALIGN64(&this->affine_bias,
+        sizeof(float) * ALIGNUP(dc.dims.oc, 16));
+  }
 
   this->prop_kind = dc.prop_kind;
 
@@ -88,6 +244,26 @@ elx_conv_t::elx_conv_t(eld_conv_t &dc)
   this->sum_quant_z = dc.sum_quant.z;
   this->sampling_kind = dc.sampling_kind;
 
+  this->output_quant_per_oc = dc.output_quant_oc.scale != nullptr;
+  if (this->output_quant_per_oc) {
+    if (!estl::any_of(dc.data_type.output, u8, s8))
+      el_error("Per-oc output quantization: u8/s8 output only");
+    if (!estl::any_of(dc.algorithm, CONV_DIRECT, CONV_DIRECT_1X1,
+                      CONV_WINOGRAD, DECONV_DIRECT))
+      el_error("Per-oc output quantization: algorithm not supported");
+    if (dc.with_ip_sum)
+      el_error("Per-oc output quantization: inplace sum not supported");
+
+    // padded oc: repS = 1, z = 0
+    this->output_quant_oc_repS.assign(ALIGNUP(dc.dims.oc, 16), 1.0f);
+    this->output_quant_oc_z.assign(ALIGNUP(dc.dims.oc, 16), 0.0f);
+    iter_each (_oc, dc.dims.oc) {
+      this->output_quant_oc_repS[_oc] = 1 / dc.output_quant_oc.scale[_oc];
+      if (dc.output_quant_oc.z != nullptr)
+        this->output_quant_oc_z[_oc] = dc.output_quant_oc.z[_oc];
+    }
+  }
+
   this->ormask = (unsigned int)-1;
   this->output_ptr = nullptr;
   this->input_ptr = nullptr;
@@ -156,6 +332,187 @@ void elx_conv_t::timed_execute(void *output, void *input, void *weights, void *b
       hrc_duration(hrc::now() - start_ts).count());
 }
 
+void elx_conv_t::run(void *output, void *input, void *weights, void *bias)
+{
+  if (with_affine) {
+    if (weights != affine_weights_src || bias != affine_bias_src) {
+      fold_affine((float *)weights, (float *)bias);
+      affine_weights_src = weights;
+      affine_bias_src = bias;
+    }
+    weights = affine_weights;
+    bias = affine_bias;
+  }
+
+  if (!with_view) {
+    execute_pool(output, input, weights, bias);
+    return;
+  }
+
+  // Tensor views: image _n of user tensors, dense or staged
+  const int OH = with_pool ? pool_oh : oh, OW = with_pool ? pool_ow : ow;
+  const size_t ies = elem_size(input_data_type);
+  const size_t oes = elem_size(output_data_type);
+
+  iter_each (_n, view_n) {
+    char *in = view_image(input, input_fmt, input_view, _n, ies);
+    char *out = view_image(output, output_fmt, output_view, _n, oes);
+
+    if (view_tinput != nullptr) {
+      copy_view(in, (char *)view_tinput, input_fmt, input_view, ic, ih, iw,
+          ies, false);
+      in = (char *)view_tinput;
+    } else {
+      in += view_offset(input_fmt, input_view, ies);
+    }
+    char *conv_out = out + view_offset(output_fmt, output_view, oes);
+    if (view_toutput != nullptr) {
+      if (with_ip_sum)
+        copy_view(out, (char *)view_toutput, output_fmt, output_view, oc,
+            OH, OW, oes, false);
+      conv_out = (char *)view_toutput;
+    }
+
+    execute_pool(conv_out, in, weights, bias);
+
+    if (view_toutput != nullptr)
+      copy_view(out, (char *)view_toutput, output_fmt, output_view, oc, OH,
+          OW, oes, true);
+  }
+}
+
+// Execute and pool the conv output of n images
+void elx_conv_t::execute_pool(
+    void *output, void *input, void *weights, void *bias)
+{
+  void *conv_output = with_pool ? pool_toutput : output;
+  if (verbose)
+    timed_execute(conv_output, input, weights, bias);
+  else
+    execute(conv_output, input, weights, bias);
+
+  if (with_pool)
+    pool((float *)output, pool_toutput);
+}
+
+// Fold per-oc affine epilogue into user format weights and bias:
+// W[oc] * scale[oc], bias[oc] * scale[oc] + shift[oc]
+void elx_conv_t::fold_affine(float *weights, float *bias)
+{
+  const int G = affine_user.g, ICg = affine_user.icg;
+  const int OCg = affine_user.ocg, KH = affine_user.kh;
+  const int KW = affine_user.kw;
+  const bool is_blocked = estl::any_of(weights_fmt, OIhw16i16o, gOIhw16i16o);
+  // blocked: padded ic/oc per group
+  const int ICp = is_blocked ? ALIGNUP(ICg, 16) : ICg;
+  const int OCp = is_blocked ? ALIGNUP(OCg, 16) : OCg;
+
+  // index of (_g, _oc, _ic, _kh, _kw) in user format
+  auto index = [&](int _g, int _oc, int _ic, int _kh, int _kw) -> size_t {
+    if (estl::any_of(weights_fmt, oihw, goihw)) {
+      return ((((size_t)_g * OCg + _oc) * ICg + _ic) * KH + _kh) * KW + _kw;
+    } else if (estl::any_of(weights_fmt, hwio, ghwio)) {
+      return ((((size_t)_g * KH + _kh) * KW + _kw) * ICg + _ic) * OCg + _oc;
+    } else {
+      return ((((((size_t)_g * (OCp / 16) + _oc / 16) * (ICp / 16) + _ic / 16)
+          * KH + _kh) * KW + _kw) * 16 + _ic % 16) * 16 + _oc % 16;
+    }
+  };
+
+  memcpy(affine_weights, weights, affine_user.size);
+#pragma omp parallel for collapse(2)
+  iter_each (_g, G) {
+    iter_each (_oc, OCp) {
+      float S = _oc < OCg ? affine_scale[_g * OCg + _oc] : 1.0f;
+      iter_each (_ic, ICp) {
+        iter_each (_kh, KH) {
+          iter_each (_kw, KW) {
+            size_t i = index(_g, _oc, _ic, _kh, _kw);
+            affine_weights[i] = weights[i] * S;
+          }
+        }
+      }
+    }
+  }
+
+  // user bias may be not OC aligned
+  const int OC = G * OCg;
+  iter_each (_oc, ALIGNUP(OC, 16)) {
+    float b = _oc < OC && affine_user.with_bias ? bias[_oc] : 0.0f;
+    affine_bias[_oc] = _oc < OC ? b * affine_scale[_oc] + affine_shift[_oc]
+                                : 0.0f;
+  }
+}
+
+// Pool conv output toutput (n, pool_ih, pool_iw) into output (n, pool_oh,
+// pool_ow), both in output_fmt. No padding.
+void elx_conv_t::pool(float *output, float *toutput)
+{
+  const int C = pool_c;
+  const bool is_max = pool_alg == POOL_MAX;
+  const float rwin = 1.0f / (pool_kh * pool_kw);
+
+  if (output_fmt == nchw) {
+#pragma omp parallel for collapse(3)
+    iter_each (_n, n) {
+      iter_each (_c, C) {
+        iter_each (_ph, pool_oh) {
+          float *tout = &toutput[(((size_t)_n * C + _c) * pool_ih
+              + _ph * pool_sh) * pool_iw];
+          float *out = &output[(((size_t)_n * C + _c) * pool_oh + _ph)
+              * pool_ow];
+          iter_each (_pw, pool_ow) {
+            float r = is_max ? -FLT_MAX : 0.0f;
+            iter_each (_kh, pool_kh) {
+              iter_each (_kw, pool_kw) {
+                float v = tout[_kh * pool_iw + _pw * pool_sw + _kw];
+                r = is_max ? estl::max(r, v) : r + v;
+              }
+            }
+            out[_pw] = is_max ? r : r * rwin;
+          }
+        }
+      }
+    }
+    return;
+  }
+
+  // nhwc and nChw16c: V channels a vector, tail masked for nhwc
+  const int V = 16;
+  const int C2 = ALIGNUP(C, V) / V;
+  const bool is_nhwc = output_fmt == nhwc;
+  const __mmask16 kr = is_nhwc && C % V ? (1 << (C % V)) - 1 : 0xffff;
+
+  auto addr = [&](float *t, int _n, int _C2, int _h, int _w, int H, int W) {
+    return is_nhwc
+        ? &t[(((size_t)_n * H + _h) * W + _w) * C + _C2 * V]
+        : &t[((((size_t)_n * C2 + _C2) * H + _h) * W + _w) * V];
+  };
+
+#pragma omp parallel for collapse(3)
+  iter_each (_n, n) {
+    iter_each (_C2, C2) {
+      iter_each (_ph, pool_oh) {
+        __mmask16 k = _C2 == C2 - 1 ? kr : 0xffff;
+        iter_each (_pw, pool_ow) {
+          __m<V> r = is_max ? _mm<V>::set1_ps(-FLT_MAX) : _mm<V>::setzero_ps();
+          iter_each (_kh, pool_kh) {
+            iter_each (_kw, pool_kw) {
+              __m<V> v = _mm512_maskz_loadu_ps(k, addr(toutput, _n, _C2,
+                  _ph * pool_sh + _kh, _pw * pool_sw + _kw, pool_ih, pool_iw));
+              r = is_max ? _mm<V>::max_ps(r, v) : _mm<V>::add_ps(r, v);
+            }
+          }
+          if (!is_max)
+            r = _mm<V>::mul_ps(r, _mm<V>::set1_ps(rwin));
+          _mm512_mask_storeu_ps(
+              addr(output, _n, _C2, _ph, _pw, pool_oh, pool_ow), k, r);
+        }
+      }
+    }
+  }
+}
+
 int elx_conv(eld_conv_t &desc, void *output, void *input, void *weights, void *bias)
 {
   elx_conv_t *xc = desc.xc;
@@ -168,10 +525,16 @@ int elx_conv(eld_conv_t &desc, void *output, void *input, void *weights, void *b
   }
 
   if (xc->eager_mode) {
-    if (xc->verbose)
-      xc->timed_execute(output, input, weights, bias);
-    else
-      xc->execute(output, input, weights, bias);
+    // Observe input before it could be overwritten by in-place output
+    if (xc->calib != nullptr)
+      xc->calib->input.update((float *)input,
+          xc->n, xc->ic, xc->ih * xc->iw, xc->input_fmt);
+
+    xc->run(output, input, weights, bias);
+
+    if (xc->calib != nullptr)
+      xc->calib->output.update((float *)output,
+          xc->n, xc->oc, xc->oh * xc->ow, xc->output_fmt);
   } else {
     xc->set_data(output, input, weights, bias);
     global_stream.submit(xc);
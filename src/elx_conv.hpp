@@ -1,9 +1,13 @@
 #pragma once
 
 #include <mutex>
+#include <vector>
 #include "euler.hpp"
 #include "el_def.hpp"
+#include "el_intrin.hpp"
+#include "el_eltwise.hpp"
 #include "el_shared_workspace.hpp"
+#include "elx_calib.hpp"
 
 namespace euler {
 
@@ -35,6 +39,8 @@ struct elx_conv_params_t {
   // int A;
   // register working set
   int T;
+  // output rows per kernel of 2-D register blocking, tailing rows
+  int H, Hr;
   // padding (IC/OC) & tailing dimensions: Ir, Or, Tr
   int IC, OC, Ir, Or, Tr, O2r, oc3r;
   // 2nd/r3d level cache blocking unit(in pack) to ic, oc
@@ -47,6 +53,8 @@ struct elx_conv_params_t {
   int hd, wd;
   // saved group number, ic, oc per group, kernel multi-group number
   int grp, icg, ocg, vmg;
+  // vmg input permutation, icg * V lanes, for icg < ocg
+  std::vector<int> vmg_perm;
   // Or masks
   unsigned int ormask;
 
@@ -60,6 +68,26 @@ struct elx_conv_params_t {
 
   // relu, bias, sum
   bool with_relu, with_bias, with_ip_sum, with_op_sum, with_argmax, f16c_opt;
+  // activation of with_relu (relu_idx): ACT_*
+  int act_alg;
+  float act_alpha, act_beta;
+
+  // fused pooling: POOL_MAX | POOL_AVG, window, stride, pooled channels
+  // and conv output (pooling input) and pooled output sizes
+  bool with_pool;
+  int pool_alg, pool_kh, pool_kw, pool_sh, pool_sw;
+  int pool_c, pool_ih, pool_iw, pool_oh, pool_ow;
+
+  // per-oc affine epilogue folded into weights and bias, OC aligned:
+  // scale 1, shift 0 for padded oc
+  bool with_affine;
+  std::vector<float> affine_scale, affine_shift;
+
+  // tensor views: conv of one image (n = 1) run per image of view_n on
+  // the regions of user tensors, c/h/w of dims if not given
+  bool with_view;
+  int view_n;
+  decltype(eld_conv_t::input_view) input_view, output_view;
 
   // streaming hint
   int streaming_input;
@@ -90,6 +118,10 @@ struct elx_conv_params_t {
   float output_quant_repS;
   float sum_quant_S;
   float sum_quant_z;
+  // per-oc output quantization, OC aligned
+  bool output_quant_per_oc;
+  std::vector<float> output_quant_oc_repS;
+  std::vector<float> output_quant_oc_z;
   sampling_kind_t sampling_kind;
 
   bool verbose;
@@ -101,20 +133,84 @@ struct elx_conv_params_t {
   shared_workspace_mgr_t *shared_workspace_mgr;
 
   void *scratch_pad;
+  // conv output before pooling, nullptr if pooling is not fused
+  float *pool_toutput;
+  // dense input/output of an image of tensor views, nullptr if zero copy
+  void *view_tinput, *view_toutput;
+  // weights and bias folded with affine epilogue, user weights and bias
+  // they are folded from, user weights dims and with_bias
+  float *affine_weights, *affine_bias;
+  void *affine_weights_src, *affine_bias_src;
+  struct {
+    int g, icg, ocg, kh, kw;
+    size_t size;
+    bool with_bias;
+  } affine_user;
   void *output_ptr, *input_ptr, *weights_ptr, *bias_ptr;
-  std::mutex mu;
+  // observe mode statistics, nullptr if not observing
+  elx_calib_t *calib;
+
+  // Activation epilogue of x, x is u8/s8 output quantized if quantized
+  template <int V, bool quantized = false>
+  inline __m<V> activate(__m<V> x) {
+    if (!quantized || act_alg == ACT_RELU)
+      return eltwise<V>::compute(act_alg, act_alpha, act_beta, x);
+    __m<V> z = _mm<V>::set1_ps(output_quant_z);
+    x = (x - z) * _mm<V>::set1_ps(output_quant_S);
+    x = eltwise<V>::compute(act_alg, act_alpha, act_beta, x);
+    return x * _mm<V>::set1_ps(output_quant_repS) + z;
+  }
+
+  // Sum then activation on plain format output: first v channels of out,
+  // strided by vindex, become activate(out + x)
+  template <int V>
+  inline void sum_activate_plain(float *out, __i<V> vindex, __m<V> x,
+                                 int v = V) {
+    __mmask16 k = _cvtu32_mask16((1u << v) - 1);
+    __m<V> s = _mm512_mask_i32gather_ps(
+        _mm<V>::setzero_ps(), k, vindex, out, sizeof(float));
+    _mm512_mask_i32scatter_ps(out, k, vindex, activate<V>(x + s),
+        sizeof(float));
+  }
+
+  // Output requantization coefficients of oc-block _oc2
+  template <int V>
+  inline void load_output_quant(int _oc2, __m<V> &repS, __m<V> &z) {
+    if (output_quant_per_oc) {
+      repS = _mm<V>::loadu_ps(&output_quant_oc_repS[_oc2 * V]);
+      z = _mm<V>::loadu_ps(&output_quant_oc_z[_oc2 * V]);
+    } else {
+      repS = _mm<V>::set1_ps(output_quant_repS);
+      z = _mm<V>::set1_ps(output_quant_z);
+    }
+  }
 };
 
 struct elx_conv_t : elx_conv_params_t {
 public:
+  std::mutex mu;
+
   elx_conv_t(eld_conv_t &dc);
 
   void set_data(void *output, void *input, void *weights, void *bias);
   void timed_execute(void *output, void *input, void *weights, void *bias);
+  // execute and fused epilogues of the conv output, per image of tensor
+  // views
+  void run(void *output, void *input, void *weights, void *bias);
+  void pool(float *output, float *toutput);
+  void execute_pool(void *output, void *input, void *weights, void *bias);
+  void fold_affine(float *weights, float *bias);
 
   virtual void execute(
       void *output, void *input, void *weights, void *bias) = 0;
-  virtual ~elx_conv_t() {}
+  virtual ~elx_conv_t() {
+    delete calib;
+    free(pool_toutput);
+    free(affine_weights);
+    free(affine_bias);
+    free(view_tinput);
+    free(view_toutput);
+  }
 };
 
 }  // namespace euler
@@ -13,6 +13,7 @@ Instance_elx_conv_direct_t::elx_conv_direct_t(eld_conv_t &dc)
   // user input
   xopt_ = this->execution_mode;
   mthr_ = omp_get_max_threads();
+  stage_ = false;
 
   this->vmg = 1;
   this->Vx = 1;
@@ -35,7 +36,7 @@ Instance_elx_conv_direct_t::elx_conv_direct_t(eld_conv_t &dc)
   this->OC = ALIGNUP(this->oc, V);
 
   if (this->I2 == 0) this->I2 = 1;
-  if (this->T == 0)  this->T = 1;
+  if (this->T == 0)  this->T = xopt_ == 0xa061 ? estl::min(this->ow, 7) : 1;
   if (this->O == 0)  this->O = 1;
   if (this->O1 == 0) this->O1 = 1;
   this->O2 = this->O * this->O1;
@@ -47,18 +48,27 @@ Instance_elx_conv_direct_t::elx_conv_direct_t(eld_conv_t &dc)
   this->oc2 = this->OC / V;
 
   // t3, t2, (T, Tr)
-  if (xopt_ == 0xa060 || xopt_ == 0xb060 || xopt_ == 0xd060) {
+  if (xopt_ == 0xa060 || xopt_ == 0xa061 || xopt_ == 0xb060 ||
+      xopt_ == 0xd060) {
+    // a061: H rows x T pixels x O blocks of accumulators (<= 28)
+    this->H = 1;
+    if (xopt_ == 0xa061 && this->O * this->T <= 28)
+      this->H = estl::min(estl::min(this->oh, 4), 28 / (this->O * this->T));
+    this->Hr = this->oh % this->H ? this->oh % this->H : this->H;
+
     this->t3 = this->n;
-    this->ht = this->oh;
+    this->ht = (this->oh + this->H - 1) / this->H;
     this->wt = (this->ow + this->T - 1)/ this->T;
     this->Tr = this->ow % this->T ? this->ow % this->T : this->T;
     this->nt = this->oh * this->ow;
     this->t2 = this->nt / this->T;
     this->t = this->nt * this->n;
 
-    if (this->T <= this->lp || this->Tr <= this->rp) {
-      el_error("Unimplemented T: (T,Tr) must greater than (lp,rp)");
-    }
+    // a060/b060 kernels handle a kw/2 halo within the first/last tile
+    // only, otherwise border tiles run on input staged with zero halo.
+    stage_ = xopt_ != 0xd060 && xopt_ != 0xa061 &&
+        (this->T <= this->lp || this->Tr <= this->rp ||
+         !estl::any_of(this->lp, 0, this->kw / 2) || this->rp > this->lp);
     bool format_ok =
         estl::any_of(this->weights_fmt, hwio, ghwio, OIhw16i16o, gOIhw16i16o) &&
         (((this->input_fmt == nhwc) && (this->output_fmt == nhwc)) ||
@@ -67,6 +77,8 @@ Instance_elx_conv_direct_t::elx_conv_direct_t(eld_conv_t &dc)
           (this->output_fmt == nChw16c)) ||
          (V == 16 && xopt_ == 0xb060 && this->g == 1 &&
           (this->input_fmt == nChw16c) && (this->output_fmt == nChw16c)) ||
+         (V == 16 && xopt_ == 0xa061 && this->g == 1 &&
+          (this->input_fmt == nChw16c) && (this->output_fmt == nChw16c)) ||
          (V == 16 && xopt_ == 0xd060 && (this->input_fmt == nChw16c) &&
           (this->output_fmt == nChw16c)));
     if (!format_ok) {
@@ -77,13 +89,23 @@ Instance_elx_conv_direct_t::elx_conv_direct_t(eld_conv_t &dc)
       bool shape_ok = estl::any_of(this->kh, 3, 5, 7)
           && estl::any_of(this->kw, 3, 5, 7)
           && (this->ws == 1 || this->ws == 2)
-          && estl::any_of(this->lp, 0, this->kw / 2)
+          && (stage_ || estl::any_of(this->lp, 0, this->kw / 2))
           && estl::any_of(this->tp, 0, this->kh / 2);
       if (!shape_ok) {
         el_error("direct: a060: shape not supported");
       }
     }
 
+    // any kernel size, padding and dilation
+    if (xopt_ == 0xa061) {
+      bool shape_ok = (this->ws == 1 || this->ws == 2)
+          && estl::any_of(this->O, 1, 2) && this->T <= 14
+          && this->O * this->T <= 28;
+      if (!shape_ok) {
+        el_error("direct: a061: shape not supported");
+      }
+    }
+
     if (this->g == 1 && this->ic < V) {
       bool ok = this->input_fmt == nchw
           && this->weights_fmt == hwio
@@ -126,12 +148,25 @@ Instance_elx_conv_direct_t::elx_conv_direct_t(eld_conv_t &dc)
   attr_ = this->with_bias ? set_attr(attr_, bias_idx) : attr_;
   attr_ = this->with_ip_sum ? set_attr(attr_, ip_sum_idx) : attr_;
 
+  // Kernel view of a staged input window: kh x ((T - 1) * ws + kw)
+  xs_ = *this;
+  xs_.ih = this->kh;
+  xs_.iw = (this->T - 1) * this->ws + this->kw;
+  // Kernel view of a partial tile: T pixels
+  xp_ = *this;
+  xp_.oh = 1;
+  xp_.ow = this->T;
+  xsp_ = xs_;
+  xsp_.oh = 1;
+  xsp_.ow = this->T;
+
   prepare_execute_opt();
   bind_execute_functions();
 
   // dbg
-  printf("T=%d, Tr=%d, t2=%d, ht=%d, wt=%d, t=%d\n",
-      this->T, this->Tr, this->t2, this->ht, this->wt, this->t);
+  printf("T=%d, Tr=%d, H=%d, Hr=%d, t2=%d, ht=%d, wt=%d, t=%d\n",
+      this->T, this->Tr, this->H, this->Hr, this->t2, this->ht, this->wt,
+      this->t);
   printf("V=%d, Ir=%d, I2=%d, ic3=%d, ic4=%d, IC=%d, g=%d\n",
       V, this->Ir, this->I2, this->ic3, this->ic4, this->IC, this->g);
   printf("V=%d, Or=%d, O2=%d (O=%d, O1=%d), oc3=%d, oc4=%d, O2r=%d, oc3r=%d, OC=%d, g=%d\n",
@@ -147,16 +182,25 @@ int Instance_elx_conv_direct_t::prepare_execute_opt()
   }
 
   toutput_size_ = 0;
+  tpartial_size_ = 0;
   tweights_size_ = 0;
+  sinput_size_ = 0;
   tweights_ = nullptr;
   toutput_ = nullptr;
+  sinput_ = nullptr;
   scratch_ = nullptr;
   workspace_ = nullptr;
 
   switch (xopt_) {
   case 0xb060:
-    toutput_size_ = this->ic4 * this->t3 * this->g * this->OC * this->oh * this->ow * sizeof(ToutputType);
+    // K-split of ic4: partial tile of T x oc (nhwc) | oc3 * O2 x T x V
+    tpartial_size_ = ALIGNUP(this->T * (this->output_fmt == nhwc
+        ? this->oc : this->oc3 * this->O2 * V), V);
+    if (this->ic4 > 1)
+      toutput_size_ = mthr_ * tpartial_size_ * sizeof(ToutputType);
+    turns_.setup(this->t3 * this->oc4 * this->ht * this->wt, this->ic4);
   case 0xa060:
+  case 0xa061:
   case 0xd060:
     tweights_size_ = this->g * this->kh * this->kw * this->IC * this->OC * sizeof(TweightsType);
     break;
@@ -170,11 +214,18 @@ int Instance_elx_conv_direct_t::prepare_execute_opt()
   if (tweights_size_ > 0)
     tweights_size_ += WEIGHTS_MAX_PRELOAD * V;
 
-  size_t workspace_size = tweights_size_;
+  // per-thread staged input window
+  if (stage_) {
+    size_t nc = estl::max(this->ic3 * this->I2 * V, this->g * this->ic);
+    sinput_size_ = ALIGNUP(nc * xs_.ih * xs_.iw * sizeof(InputType), 64);
+  }
+
+  size_t workspace_size = tweights_size_ + mthr_ * sinput_size_;
   // TODO: user provided buffer
   if (workspace_size != 0) {
     MEMALIGN64(&workspace_, workspace_size);
     tweights_ = (TweightsType *)workspace_;
+    sinput_ = (InputType *)((char *)workspace_ + tweights_size_);
   }
   size_t scratchpad_size = toutput_size_;
   if (scratchpad_size != 0) {
@@ -368,15 +419,28 @@ Instance_elx_conv_direct_t::conv_a060(OutputType *output,
   int khe = estl::min(this->kh, this->ih + this->tp - this->hs * _ht);
   int kws = _wt == 0 ? this->lp : 0;
   int kwe = _wt == this->wt - 1 ? this->kw - this->lp : this->kw;
-  assert(this->T > this->lp && this->Tr > this->rp);
 
   auto _ih = _ht * this->hs + (this->kh / 2) - this->tp;
   auto _iw = _wt * this->T * this->ws + (this->kw / 2) - this->lp;
   int pad_l = (_wt == 0) && (this->lp > 0);
   int pad_r = (_wt == this->wt - 1) && (this->lp > 0);
 
+  elx_conv_params_t *xc = this;
+  if (stage_) {
+    kws = 0;
+    kwe = this->kw;
+    pad_l = pad_r = 0;
+    int nb = this->input_fmt == nchw && this->g == 1 && this->ic < V
+        ? this->Ir : this->ic3 * this->I2 * V;
+    if (stage_input(input, nb, _ht, _wt, khs, khe)) {
+      xc = &xs_;
+      _ih = this->kh / 2;
+      _iw = this->kw / 2;
+    }
+  }
+
   if (this->input_fmt == nhwc) {
-    MD4(InputType, ainput0, input, this->ih, this->iw, this->g, this->ic);
+    MD4(InputType, ainput0, input, xc->ih, xc->iw, this->g, this->ic);
     MD3(InputType, ainput1, &md4(ainput0, _ih, _iw, 0, 0), this->ic4, this->ic3, this->I2 * V);
     MD2(OutputType, aoutput, output, this->oc3, this->O2 * V);
 
@@ -390,12 +454,12 @@ Instance_elx_conv_direct_t::conv_a060(OutputType *output,
       if (this->Or != V && _oc4 == this->oc4 - 1 && _oc3 == this->oc3 - 1) {
         attr = set_attr(attr, has_Or_idx);
       }
-      ker_conv(*this, &md2(aoutput, _oc3, 0),
+      ker_conv(*xc, &md2(aoutput, _oc3, 0),
           &md3(ainput1, 0, _ic3, 0), &md3(aweights, _oc3, _ic3, 0),
           &md2(abias, _oc3, 0), khs, khe, kws, kwe, pad_l, pad_r, attr);
     }}
   } else if (this->input_fmt == nchw) {
-    MD4(InputType, ainput, input, this->ic3, this->I2 * V, this->ih, this->iw);
+    MD4(InputType, ainput, input, this->ic3, this->I2 * V, xc->ih, xc->iw);
     MD2(OutputType, aoutput, output, this->oc3, this->O2 * this->ht * this->ow * V);
 
     iter_each(_oc3, this->oc3) {
@@ -405,12 +469,12 @@ Instance_elx_conv_direct_t::conv_a060(OutputType *output,
         if (this->Ir != V) attr = set_attr(attr, has_Ir_idx);
         if (this->with_relu) attr = set_attr(attr, relu_idx);
       }
-      ker_conv(*this, &md2(aoutput, _oc3, 0),
+      ker_conv(*xc, &md2(aoutput, _oc3, 0),
           &md4(ainput, _ic3, 0, _ih, _iw), &md3(aweights, _oc3, _ic3, 0),
           &md2(abias, _oc3, 0), khs, khe, kws, kwe, pad_l, pad_r, attr);
     }}
   } else { // blocked
-    MD5(InputType, ainput, input, this->ic3, this->I2, this->ih, this->iw, V);
+    MD5(InputType, ainput, input, this->ic3, this->I2, xc->ih, xc->iw, V);
     MD2(OutputType, aoutput, output, this->oc3, this->O2 * this->ht * this->ow * V);
 
     iter_each(_oc3, this->oc3) {
@@ -420,13 +484,67 @@ Instance_elx_conv_direct_t::conv_a060(OutputType *output,
         if (this->Ir != V) attr = set_attr(attr, has_Ir_idx);
         if (this->with_relu) attr = set_attr(attr, relu_idx);
       }
-      ker_conv(*this, &md2(aoutput, _oc3, 0),
+      ker_conv(*xc, &md2(aoutput, _oc3, 0),
           &md5(ainput, _ic3, 0, _ih, _iw, 0), &md3(aweights, _oc3, _ic3, 0),
           &md2(abias, _oc3, 0), khs, khe, kws, kwe, pad_l, pad_r, attr);
     }}
   }
 }
 
+// H x T tile of output rows, any kernel size, padding and dilation
+Template_elx_conv_direct_t void
+Instance_elx_conv_direct_t::conv_a061(OutputType *output,
+    InputType *input, TweightsType *weights, BiasType *bias, int _ic4, int _oc4,
+    int _ht, int _wt)
+{
+  // input (blocked):  ic3*, I2, ih, iw, V
+  // input (nhwc):  ih, iw, ic4, ic3*, I2, V
+  // output (blocked):  oc3*, O2, oh, ow, V
+  // output (nhwc):  oh, ow, oc4, oc3*, O2, V
+  MD3(TweightsType, aweights, weights, this->oc3, this->ic3,
+      this->kh * this->kw * this->O2 * this->I2 * V * V);
+  MD2(BiasType, abias, bias, this->oc3, this->O2 * V);
+
+  bool is_Hr = _ht == this->ht - 1, is_Tr = _wt == this->wt - 1;
+  auto ker_conv = ker_conv_2d_[is_Hr][is_Tr];
+  int Hz = is_Hr ? this->Hr : this->H;
+  int Tz = is_Tr ? this->Tr : this->T;
+
+  int _ih = _ht * this->H * this->hs - this->tp;
+  int _iw = _wt * this->T * this->ws - this->lp;
+  bool border = _ih < 0 || _iw < 0 ||
+      _ih + (Hz - 1) * this->hs + (this->kh - 1) * this->hd >= this->ih ||
+      _iw + (Tz - 1) * this->ws + (this->kw - 1) * this->wd >= this->iw;
+
+  MD2(InputType, ainput_nhwc, input, this->ic3, this->I2 * V);
+  MD2(InputType, ainput_blocked, input, this->ic3,
+      this->I2 * this->ih * this->iw * V);
+  MD2(OutputType, aoutput_nhwc, output, this->oc3, this->O2 * V);
+  MD2(OutputType, aoutput_blocked, output, this->oc3,
+      this->O2 * this->oh * this->ow * V);
+
+  iter_each(_oc3, this->oc3) {
+  iter_each(_ic3, this->ic3) {
+    int attr = (_ic4 == 0 && _ic3 == 0) ? set_attr(attr_, r_output_idx) : attr_;
+    if (_ic4 == this->ic4 - 1 && _ic3 == this->ic3 - 1) {
+      if (this->Ir != V) attr = set_attr(attr, has_Ir_idx);
+      if (this->with_relu) attr = set_attr(attr, relu_idx);
+    }
+    if (this->output_fmt == nhwc && this->Or != V && _oc4 == this->oc4 - 1
+        && _oc3 == this->oc3 - 1) {
+      attr = set_attr(attr, has_Or_idx);
+    }
+    OutputType *aout = this->output_fmt == nhwc
+                           ? &md2(aoutput_nhwc, _oc3, 0)
+                           : &md2(aoutput_blocked, _oc3, 0);
+    InputType *ain = this->input_fmt == nhwc
+                         ? &md2(ainput_nhwc, _ic3, 0)
+                         : &md2(ainput_blocked, _ic3, 0);
+    ker_conv(*this, aout, ain, &md3(aweights, _oc3, _ic3, 0),
+        &md2(abias, _oc3, 0), _ih, _iw, border, attr);
+  }}
+}
+
 // kh,kw=odd, lp=rp=standard, ih=oh*hs, iw=ow*ws, hs=ws=1
 Template_elx_conv_direct_t void
 Instance_elx_conv_direct_t::conv_b060(OutputType *output,
@@ -435,9 +553,11 @@ Instance_elx_conv_direct_t::conv_b060(OutputType *output,
 {
   // input:   ic3*, I2, V, ht*, hs*, wt*, T, ws
   // output:  oc3*, O2, ht*, wt*, T, V
+  // partial (ic4 slice > 0): oc3*, O2, T, V (blocked) | T, oc (nhwc)
   MD3(TweightsType, aweights, weights, this->oc3, this->ic3,
       this->kh * this->kw * this->O2 * this->I2 * V * V);
   MD2(BiasType, abias, bias, this->oc3, this->O2 * V);
+  bool partial = _ic4 > 0;
 
   auto ker_conv = _wt == this->wt - 1 ? ker_conv_Tr_ : ker_conv_;
 
@@ -445,17 +565,28 @@ Instance_elx_conv_direct_t::conv_b060(OutputType *output,
   int khe = estl::min(this->kh, this->ih + this->tp - this->hs * _ht);
   int kws = _wt == 0 ? this->lp : 0;
   int kwe = _wt == this->wt - 1 ? this->kw - this->lp : this->kw;
-  assert(this->T > this->lp && this->Tr > this->rp);
 
   auto _ih = _ht * this->hs + (this->kh / 2) - this->tp;
   auto _iw = _wt * this->T * this->ws + (this->kw / 2) - this->lp;
   int pad_l = (_wt == 0) && (this->lp > 0);
   int pad_r = (_wt == this->wt - 1) && (this->lp > 0);
 
+  elx_conv_params_t *xc = partial ? &xp_ : this;
+  if (stage_) {
+    kws = 0;
+    kwe = this->kw;
+    pad_l = pad_r = 0;
+    if (stage_input(input, this->I2 * V, _ht, _wt, khs, khe)) {
+      xc = partial ? &xsp_ : &xs_;
+      _ih = this->kh / 2;
+      _iw = this->kw / 2;
+    }
+  }
+
   MD2(OutputType, aoutput_nhwc, output, this->oc3, this->O2 * V);
-  MD2(OutputType, aoutput_blocked, output, this->oc3, this->O2 * this->ht * this->ow * V);
-  MD3(InputType, ainput_nhwc, input, this->ih, this->iw, this->ic);
-  MD4(InputType, ainput_blocked, input, this->I2, this->ih, this->iw, V);
+  MD2(OutputType, aoutput_blocked, output, this->oc3, this->O2 * xc->oh * xc->ow * V);
+  MD3(InputType, ainput_nhwc, input, xc->ih, xc->iw, this->ic);
+  MD4(InputType, ainput_blocked, input, this->I2, xc->ih, xc->iw, V);
 
   iter_each(_oc3, this->oc3) {
     OutputType *aout = this->output_fmt == nhwc
@@ -464,6 +595,7 @@ Instance_elx_conv_direct_t::conv_b060(OutputType *output,
     InputType *ain   = this->input_fmt == nhwc
                            ? &md3(ainput_nhwc, _ih, _iw, 0)
                            : &md4(ainput_blocked, 0, _ih, _iw, 0);
+    // slice 0 in place with bias and sum, partials of the slice only
     int attr = 0;
     if (_ic3 == 0) {
       attr = (_ic4 == 0) ? attr_ : attr;
@@ -471,16 +603,121 @@ Instance_elx_conv_direct_t::conv_b060(OutputType *output,
     }
     if (_ic4 == this->ic4 - 1 && _ic3 == this->ic3 - 1) {
       if (this->Ir != V) attr = set_attr(attr, has_Ir_idx);
+      if (this->with_relu && !partial) attr = set_attr(attr, relu_idx);
     }
     if (this->output_fmt == nhwc && this->Or != V && _oc4 == this->oc4 - 1 &&
         _oc3 == this->oc3 - 1) {
       attr = set_attr(attr, has_Or_idx);
     }
-    ker_conv(*this, aout, ain, &md3(aweights, _oc3, 0, 0),
+    ker_conv(*xc, aout, ain, &md3(aweights, _oc3, 0, 0),
              &md2(abias, _oc3, 0), khs, khe, kws, kwe, pad_l, pad_r, attr);
   }
 }
 
+// Copy the input window of tile (_ht, _wt), nc channels, to the per-thread
+// buffer with zero halo. The buffer keeps the input format with ih = kh and
+// iw = (T - 1) * ws + kw (xs_). Returns false if the window has no halo.
+Template_elx_conv_direct_t
+bool Instance_elx_conv_direct_t::stage_input(
+    InputType *&input, int nc, int _ht, int _wt, int khs, int khe)
+{
+  int Tz = _wt == this->wt - 1 ? this->Tr : this->T;
+  int iws = _wt * this->T * this->ws - this->lp;
+  int iwe = iws + (Tz - 1) * this->ws + this->kw;
+  if (iws >= 0 && iwe <= this->iw)
+    return false;
+
+  int ihs = _ht * this->hs - this->tp;
+  // valid columns of the window
+  int sws = estl::max(0, -iws);
+  int swe = estl::min(xs_.iw, this->iw - iws);
+  InputType *sinput = (InputType *)((char *)sinput_
+      + omp_get_thread_num() * sinput_size_);
+
+  if (this->input_fmt == nhwc) {
+    MD3(InputType, ainput, input, this->ih, this->iw, this->g * this->ic);
+    MD3(InputType, asinput, sinput, xs_.ih, xs_.iw, this->g * this->ic);
+    for (int _kh = khs; _kh < khe; ++_kh) {
+      iter_each (_sw, xs_.iw) {
+        if (_sw >= sws && _sw < swe)
+          memcpy(&md3(asinput, _kh, _sw, 0),
+                 &md3(ainput, ihs + _kh, iws + _sw, 0), nc * sizeof(InputType));
+        else
+          memset(&md3(asinput, _kh, _sw, 0), 0, nc * sizeof(InputType));
+      }
+    }
+  } else if (this->input_fmt == nchw) {
+    MD3(InputType, ainput, input, nc, this->ih, this->iw);
+    MD3(InputType, asinput, sinput, nc, xs_.ih, xs_.iw);
+    iter_each (_c, nc) {
+      for (int _kh = khs; _kh < khe; ++_kh) {
+        iter_each (_sw, xs_.iw) {
+          md3(asinput, _c, _kh, _sw) = (_sw >= sws && _sw < swe)
+              ? md3(ainput, _c, ihs + _kh, iws + _sw) : 0;
+        }
+      }
+    }
+  } else { // blocked
+    MD4(InputType, ainput, input, nc / V, this->ih, this->iw, V);
+    MD4(InputType, asinput, sinput, nc / V, xs_.ih, xs_.iw, V);
+    iter_each (_c, nc / V) {
+      for (int _kh = khs; _kh < khe; ++_kh) {
+        iter_each (_sw, xs_.iw) {
+          if (_sw >= sws && _sw < swe)
+            memcpy(&md4(asinput, _c, _kh, _sw, 0),
+                   &md4(ainput, _c, ihs + _kh, iws + _sw, 0),
+                   V * sizeof(InputType));
+          else
+            memset(&md4(asinput, _c, _kh, _sw, 0), 0, V * sizeof(InputType));
+        }
+      }
+    }
+  }
+  input = sinput;
+  return true;
+}
+
+// K-split: partial tile of an ic4 slice added to output tile (_oc4, _wt),
+// activation by the last slice
+// output: T(Tr), oc (nhwc) | oc3*, O2, ht, ow, V (blocked), at the tile
+// toutput: T(Tr), oc (nhwc) | oc3*, O2, T, V (blocked)
+Template_elx_conv_direct_t
+void Instance_elx_conv_direct_t::add_partial(OutputType *output,
+    ToutputType *toutput, int _oc4, int _wt, bool last)
+{
+  if (!std::is_same<OutputType, float>::value)
+    el_error("Unsupported data type");
+
+  int Tz = _wt == this->wt - 1 ? this->Tr : this->T;
+  MD2(float, aoutput_nhwc, (float *)output, Tz, this->oc);
+  MD2(float, atoutput_nhwc, (float *)toutput, Tz, this->oc);
+  MD3(float, aoutput_blocked, (float *)output, this->oc3 * this->O2,
+      this->oh * this->ow, V);
+  MD3(float, atoutput_blocked, (float *)toutput, this->oc3 * this->O2,
+      this->T, V);
+  __mmask16 k = _cvtu32_mask16(this->ormask);
+
+  iter_each (_O3, this->oc3 * this->O2) {
+    bool masked = this->output_fmt == nhwc && this->Or != V
+        && _oc4 * this->oc3 * this->O2 + _O3 == this->oc2 - 1;
+    iter_each (_T, Tz) {
+      float *aout = this->output_fmt == nhwc
+          ? &md2(aoutput_nhwc, _T, _O3 * V) : &md3(aoutput_blocked, _O3, _T, 0);
+      float *atout = this->output_fmt == nhwc
+          ? &md2(atoutput_nhwc, _T, _O3 * V) : &md3(atoutput_blocked, _O3, _T, 0);
+      __m<V> mmout = masked
+          ? _mm512_maskz_loadu_ps(k, aout) + _mm512_maskz_loadu_ps(k, atout)
+          : _mm<V>::loadu_ps(aout) + _mm<V>::loadu_ps(atout);
+      if (last && this->with_relu)
+        mmout = this->template activate<V>(mmout);
+      if (masked)
+        _mm512_mask_storeu_ps(aout, k, mmout);
+      else
+        _mm512_storeu_ps(aout, mmout);
+    }
+  }
+}
+
 // slow path
 Template_elx_conv_direct_t
 void Instance_elx_conv_direct_t::gemm_d060(OutputType *output, InputType *input,
@@ -496,8 +733,6 @@ void Instance_elx_conv_direct_t::gemm_d060(OutputType *output, InputType *input,
   int ows0 = _wt * this->T;
   int khs = estl::max(0, this->tp - this->hs * _ht);
   int khe = estl::min(this->kh, this->ih + this->tp - this->hs * _ht);
-  assert(this->T > this->lp);
-  assert(this->Tr > this->rp);
 
   if (this->input_fmt == nhwc) {
     MD4(InputType, ainput0, input, this->ih, this->iw, this->g, this->ic);
@@ -533,6 +768,8 @@ void Instance_elx_conv_direct_t::gemm_d060(OutputType *output, InputType *input,
       for (int _kh = khs; _kh < khe; ++_kh) {
         auto _ih = this->hs * _ht + _kh - this->tp;
         for (int _kw = 0; _kw < this->kw; ++_kw) {
+          // column _kw entirely in halo of this tile
+          if (ker_gemm_[_wt][_kw] == nullptr) continue;
           auto _iws = this->ws * ows0 + _kw - this->lp;
           while (_iws < 0) _iws += this->ws;
           auto _ows = (_iws + this->lp - _kw) / this->ws;
@@ -557,8 +794,8 @@ void Instance_elx_conv_direct_t::gemm_d060(OutputType *output, InputType *input,
               iter_each (_T, Tz) {
                 MD4(OutputType, aoutput1, &md4(aoutput0, _ht, ows0 + _T, 0, 0),
                     this->oc4, this->oc3, this->O2, V);
-                auto s = _mm<V>::max_ps(*(__m<V> *)&md4(aoutput1, 0, _oc3, _O2, 0),
-                                        _mm<V>::setzero_ps());
+                auto s = this->template activate<V>(
+                    *(__m<V> *)&md4(aoutput1, 0, _oc3, _O2, 0));
                 _mm512_mask_store_ps(&md4(aoutput1, 0, _oc3, _O2, 0), k, s);
               }
             } else el_error("direct: d060: unimplemented");
@@ -588,6 +825,8 @@ void Instance_elx_conv_direct_t::gemm_d060(OutputType *output, InputType *input,
       for (int _kh = khs; _kh < khe; ++_kh) {
         auto _ih = this->hs * _ht + _kh - this->tp;
         for (int _kw = 0; _kw < this->kw; ++_kw) {
+          // column _kw entirely in halo of this tile
+          if (ker_gemm_[_wt][_kw] == nullptr) continue;
           auto _iws = this->ws * ows0 + _kw - this->lp;
           while (_iws < 0) _iws += this->ws;
           auto _ows = (_iws + this->lp - _kw) / this->ws;
@@ -603,9 +842,8 @@ void Instance_elx_conv_direct_t::gemm_d060(OutputType *output, InputType *input,
           iter_each (_O2, this->O2) {
           iter_each (_T, Tz) {
             if (I == ISA_SKX_AVX512 && std::is_same<OutputType, float>::value) {
-              auto s = _mm<V>::max_ps(
-                  *(__m<V> *)&md5(aoutput, _oc3, _O2, _ht, ows0 + _T, 0),
-                  _mm<V>::setzero_ps());
+              auto s = this->template activate<V>(
+                  *(__m<V> *)&md5(aoutput, _oc3, _O2, _ht, ows0 + _T, 0));
               _mm<V>::store_ps(&md5(aoutput, _oc3, _O2, _ht, ows0 + _T, 0), s);
             } else
               el_error("direct: d060: unimplemented");
@@ -5,8 +5,10 @@
 #include "el_def.hpp"
 #include "el_utils.hpp"
 #include "elx_conv.hpp"
+#include "el_parallel.hpp"
 #include "kernel/elk_gemm_otj_binder.hxx"
 #include "kernel/elk_conv_otj_binder.hxx"
+#include "kernel/elk_conv_2d_otj_binder.hxx"
 
 namespace euler {
 
@@ -36,6 +38,8 @@ Template_elx_conv_direct_t class elx_conv_direct_t : public elx_conv_t {
   private:
   void __execute_a060(OutputType *output, InputType *input,
       WeightsType *weights, BiasType *bias);
+  void __execute_a061(OutputType *output, InputType *input,
+      WeightsType *weights, BiasType *bias);
   void __execute_b060(OutputType *output, InputType *input,
       WeightsType *weights, BiasType *bias);
   void __execute_d060(OutputType *output, InputType *input,
@@ -51,10 +55,16 @@ Template_elx_conv_direct_t class elx_conv_direct_t : public elx_conv_t {
 
   void conv_a060(OutputType *output, InputType *input, TweightsType *weights,
       BiasType *bias, int _ic4, int _oc4, int _ht, int _wt);
+  void conv_a061(OutputType *output, InputType *input, TweightsType *weights,
+      BiasType *bias, int _ic4, int _oc4, int _ht, int _wt);
   void conv_b060(OutputType *output, InputType *input, TweightsType *weights,
       BiasType *bias, int _ic4, int _ic3, int _oc4, int _ht, int _wt);
   void gemm_d060(OutputType *toutput, InputType *tinput, TweightsType *tweights,
       BiasType *bias, int _ic4, int _oc4, int _ht, int _wt);
+  bool stage_input(InputType *&input, int nc, int _ht, int _wt, int khs,
+      int khe);
+  void add_partial(OutputType *output, ToutputType *toutput, int _oc4,
+      int _wt, bool last);
 
   void set_trans_buffers();
   int prepare_execute_opt();
@@ -64,6 +74,8 @@ Template_elx_conv_direct_t class elx_conv_direct_t : public elx_conv_t {
   gemm_kernel_binder::kgemm<TarrayTypes> *ker_gemm_[128][8];
   conv_kernel_binder::kconv<TarrayTypes> *ker_conv_;
   conv_kernel_binder::kconv<TarrayTypes> *ker_conv_Tr_;
+  // a061: [H|Hr][T|Tr]
+  conv_2d_kernel_binder::kconv<TarrayTypes> *ker_conv_2d_[2][2];
 
   void (elx_conv_direct_t::*execute_opt_)(
       OutputType *, InputType *, WeightsType *, BiasType *);
@@ -75,6 +87,16 @@ Template_elx_conv_direct_t class elx_conv_direct_t : public elx_conv_t {
   TweightsType *tweights_;
   size_t toutput_size_;
   ToutputType *toutput_;
+  // b060 K-split: per-thread partial tile of ic4 slices > 0, T pixels
+  // (xp_, xsp_ of staged input), added to output in turns
+  size_t tpartial_size_;
+  elx_conv_params_t xp_, xsp_;
+  ksplit_turns_t turns_;
+  // staged input of border tiles if T <= lp or Tr <= rp
+  bool stage_;
+  elx_conv_params_t xs_;
+  size_t sinput_size_;
+  InputType *sinput_;
   unsigned int xopt_;
   int attr_;
   int mthr_;
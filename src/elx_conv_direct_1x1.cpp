@@ -30,20 +30,38 @@ Instance_elx_conv_direct_1x1_t::elx_conv_direct_1x1_t(eld_conv_t &dc)
 
   no_pad_ = this->lp == 0 && this->rp == 0 && this->tp == 0 && this->bp == 0;
   if (!no_pad_) {
-    if (xopt_ != 0xa061)
-      el_error("Only 0xa061 support padding");
+    if (xopt_ == 0xf061)
+      el_error("0xf061 does not support padding");
     bool shape_ok =
       (this->oh == (this->ih - 1 + this->tp + this->bp) / this->hs + 1) &&
       (this->ow == (this->iw - 1 + this->lp + this->rp) / this->ws + 1);
     if (!shape_ok)
-      el_error("Unmatched paddding shape not supported by a061");
+      el_error("Unmatched paddding shape not supported by 1x1");
+  }
+
+  // c060 and nhwc a061 load the input in place, strided by ws in kernel
+  // and by hs in rows. Output columns out of [ows_, owe_) and rows out of
+  // input are on padding: bias/sum/activation only, no kernel.
+  direct_input_ = xopt_ == 0xc060
+      || (xopt_ == 0xa061 && this->input_fmt == nhwc);
+  if (direct_input_ && this->ws > 2)
+    el_error("Unimplemented: 1x1 in-place input with stride-w > 2");
+  ows_ = 0;
+  owe_ = this->ow;
+  if (direct_input_) {
+    ows_ = (this->lp + this->ws - 1) / this->ws;
+    owe_ = estl::min(this->ow, (this->iw - 1 + this->lp) / this->ws + 1);
+    if (owe_ <= ows_)
+      el_error("1x1: no output column on input");
   }
 
   // t3, t2, (T, Tr)
-  if (xopt_ == 0xc060 || xopt_ == 0xf061) {
-    bool shape_ok = this->hs == 1 && this->ws == 1 && no_pad_;
-    if (!shape_ok)
-      el_error("Shape not supported by c060");
+  row_tiles_ = !(xopt_ == 0xf061
+      || (xopt_ == 0xc060 && this->hs == 1 && this->ws == 1 && no_pad_));
+  if (!row_tiles_) {
+    // tiles of T (Tr at the end) over all pixels of an image
+    if (this->hs != 1 || this->ws != 1)
+      el_error("Shape not supported by f061");
 
     this->t3 = this->n;
     this->ht = this->oh;
@@ -52,23 +70,21 @@ Instance_elx_conv_direct_1x1_t::elx_conv_direct_1x1_t(eld_conv_t &dc)
     this->t = this->nt * this->n;
     this->t2 = (this->nt + this->T - 1) / this->T;
     this->Tr = this->nt % this->T ? this->nt % this->T : this->T;
-  } else if (xopt_ == 0xa061 || xopt_ == 0xb061) {
+  } else {
+    // tiles of T (Tr at the end) over columns [ows_, owe_) of a row
+    int ow = owe_ - ows_;
     this->t3 = this->n;
     this->ht = this->oh;
-    this->wt = this->ow / this->T;
+    this->wt = (ow + this->T - 1) / this->T;
     this->nt = this->oh * this->ow;
-    this->t2 = this->nt / this->T;
-    this->Tr = this->T; // No Tr support
+    this->t2 = this->ht * this->wt;
+    this->Tr = ow % this->T ? ow % this->T : this->T;
     this->t = this->nt * this->n;
-
-    if (no_pad_ && (this->ht * this->hs != this->ih
-        || this->wt * this->ws * this->T != this->iw)) {
-      el_error("Unimplemented non-unitride shape or blocking");
-    }
   }
 
   this->Ir = this->ic % V ? this->ic % V : V;
   this->Or = this->oc % V ? this->oc % V : V;
+  this->ormask = (1 << this->Or) - 1;
 
   // oc4, (oc3, oc3r), (O2, O2r)
   this->oc34 = (this->oc2 + this->O2 - 1) / this->O2;
@@ -79,21 +95,12 @@ Instance_elx_conv_direct_1x1_t::elx_conv_direct_1x1_t(eld_conv_t &dc)
   this->oc3r = this->oc34 % this->oc3;
   if (this->oc3r == 0) this->oc3r = this->oc3;
 
-  if ((xopt_ == 0xa061 || xopt_ == 0xb061 || xopt_ == 0xc060 || xopt_ == 0xf061)
-      && (this->O2r != this->O2 || this->oc3r != this->oc3)) {
-    el_error("No oc tailing for 0xa061, 0xb061, 0xe060, 0xf061");
-  }
-
   // ic4, ic3, I3
   this->ic34 = this->ic2 / this->I2;
   this->ic3 = this->ic34 / this->ic4;
   if (this->ic4 * this->ic3 * this->I2 * V != this->IC)
     el_error("IC blocking error");
 
-  if ((xopt_ == 0xa061 || xopt_ == 0xf061) && this->ic4 != 1) {
-    el_error("ic4 != 1 not support in 0xa061 and 0xf061");
-  }
-
   attr_ = 0x0;
   is_first_run_ = true;
   inference_acc_ = false;
@@ -137,8 +144,16 @@ int  Instance_elx_conv_direct_1x1_t::prepare_execute_opt()
   output_as_bfmt_ = this->output_fmt == nchw && this->output_as_blocked;
   is_bfmt_ = input_is_bfmt_ && weights_is_bfmt_ && output_is_bfmt_;
 
-  if (this->with_ip_sum && this->with_relu && !output_is_bfmt_) {
-    el_error("Unimplemented: fuse sum (plain format) and relu together");
+  act_after_sum_ = this->with_ip_sum && this->with_relu && !output_is_bfmt_
+      && (output_as_bfmt_ || this->output_fmt == nchw);
+  if (act_after_sum_ && !std::is_same<OutputType, float>::value) {
+    el_error("Unimplemented: fuse sum (plain format) and relu together "
+             "for non-fp32 output");
+  }
+  // nhwc: a061/f061 write output directly, sum in kernel before activation
+  if (this->with_ip_sum && this->output_fmt == nhwc
+      && (xopt_ == 0xa061 || xopt_ == 0xf061)) {
+    attr_ = set_attr(attr_, ip_sum_idx);
   }
 
   if (this->ic4 > 1 && this->Ir != V) {
@@ -167,22 +182,35 @@ int  Instance_elx_conv_direct_1x1_t::prepare_execute_opt()
   bweights_ = nullptr;
   boutput_ = nullptr;
 
+  // a061 nhwc: K-split if tiles are short of threads, partial of T rows
+  // of oc per thread
+  ksplit_ = xopt_ == 0xa061 && this->input_fmt == nhwc && this->ic4 > 1
+      && this->t3 * this->oc4 * this->ht * this->wt < mthr_
+      && std::is_same<OutputType, float>::value;
+  if (ksplit_)
+    turns_.setup(this->t3 * this->oc4 * this->ht * this->wt, this->ic4);
+
   switch (xopt_) {
   case 0xa061:
-    toutput_size = mthr_ * this->oc3 * this->O2 * this->T * V * sizeof(ToutputType);
+    toutput_size = mthr_ * estl::max(this->oc3 * this->O2 * this->T * V,
+        ksplit_ ? ALIGNUP(this->T * this->oc, V) : 0) * sizeof(ToutputType);
+    tinput_msk_ = (unsigned char *)malloc(mthr_ * this->ic4 * this->ht * this->wt);
+    tinput_size = mthr_ * this->IC * this->ht * this->wt * this->T * sizeof(TinputType);
+    tweights_size = this->IC * this->oc4 * this->oc3 * this->O2 * V * sizeof(TweightsType);
+    break;
   case 0xb061:
     tinput_msk_ = (unsigned char *)malloc(mthr_ * this->ic4 * this->ht * this->wt);
     tinput_size = mthr_ * this->ic3 * this->I2 * V * this->ht * this->wt * this->T * sizeof(TinputType);
-    tweights_size = this->IC * this->OC * sizeof(TweightsType);
+    tweights_size = this->IC * this->oc4 * this->oc3 * this->O2 * V * sizeof(TweightsType);
     break;
   case 0xf061:
-    tinput_msk_ = (unsigned char *)malloc(mthr_ * this->t2);
+    tinput_msk_ = (unsigned char *)malloc(mthr_ * this->ic4 * this->t2);
     toutput_size = mthr_ * this->oc3 * this->O2 * this->T * V * sizeof(ToutputType);
-    tinput_size = mthr_ * this->ic3 * this->I2 * this->T * V * this->t2 * sizeof(TinputType);
-    tweights_size = this->IC * this->OC * sizeof(TweightsType);
+    tinput_size = mthr_ * this->IC * this->T * this->t2 * sizeof(TinputType);
+    tweights_size = this->IC * this->oc4 * this->oc3 * this->O2 * V * sizeof(TweightsType);
     break;
   case 0xc060:
-    tweights_size = this->IC * this->OC * sizeof(TweightsType);
+    tweights_size = this->IC * this->oc4 * this->oc3 * this->O2 * V * sizeof(TweightsType);
     break;
   default:
       el_error("Unknown xopt!");
@@ -362,7 +390,19 @@ Template_elx_conv_direct_1x1_t
 void Instance_elx_conv_direct_1x1_t::trans_output_2_plain(
     OutputType *output, OutputType *boutput)
 {
-  if (this->with_ip_sum) {
+  if (act_after_sum_) {
+    parallel_for<3>(mthr_, [&](int _n, int _oc2, int _oh) {
+      MD5(OutputType, aboutput, boutput, this->n, this->oc2, this->oh, this->ow, V);
+      MD4(OutputType, aoutput, output, this->n, this->oc, this->oh, this->ow);
+      SET_EPI32(this->oh * this->ow)
+      int v = _oc2 == this->oc2 - 1 ? this->Or : V;
+      iter_each (_ow, this->ow) {
+        this->template sum_activate_plain<V>(
+            (float *)&md4(aoutput, _n, _oc2 * V, _oh, _ow), vindex,
+            *(__m<V> *)&md5(aboutput, _n, _oc2, _oh, _ow, 0), v);
+      }
+    }, this->n, this->oc2, this->oh);
+  } else if (this->with_ip_sum) {
     parallel_for<3>(mthr_, [&](int _n, int _oc2, int _oh) {
       MD5(OutputType, aboutput, boutput, this->n, this->oc2, this->oh, this->ow, V);
       MD4(OutputType, aoutput, output, this->n, this->oc, this->oh, this->ow);
@@ -391,44 +431,43 @@ Template_elx_conv_direct_1x1_t
 void Instance_elx_conv_direct_1x1_t::__trans_weights_post(WeightsType *aweights,
     TweightsType *tweights, int _oc4, int _ic4, int _oc3, int _ic3, int _I2, int _iV, int _O2)
 {
-  MD8(TweightsType, atweights, tweights, this->oc4, this->ic4, this->oc3, this->ic3,
-      this->I2, V, this->O2, V);
+  // oc3, ic3 blocks of I2, V, O2 (O2r at the OC tail), V
+  MD5(TweightsType, atweights5, tweights, this->oc4, this->ic4, this->oc3,
+      this->ic3, this->O2 * this->I2 * V * V);
+  MD4(TweightsType, atweights, &md5(atweights5, _oc4, _ic4, _oc3, _ic3, 0),
+      this->I2, V, O2z(_oc4, _oc3), V);
 
   if (I == ISA_SKX_AVX512 && std::is_same<WeightsType, float>::value) {
     if (std::is_same<TweightsType, float>::value) {
-      _mm<V>::store_ps(&md8(atweights, _oc4, _ic4, _oc3, _ic3, _I2, _iV, _O2, 0),
-                       *(__m<V> *)aweights);
+      _mm<V>::store_ps(&md4(atweights, _I2, _iV, _O2, 0), *(__m<V> *)aweights);
     } else {
       if (this->O == 2) { // fp32->bf16
         auto mask = _mm<V>::set1_epi32(0xFFFF0000);
         if (_O2 == 0) {
           auto si512 = _mm<V>::load_si512(aweights);
           auto w0 = _mm<V>::and_epi32(si512, mask);
-          _mm<V>::store_si512((__i<V> *)&md8(atweights, _oc4, _ic4, _oc3,
-                                             _ic3, _I2, _iV, _O2, 0), w0);
+          _mm<V>::store_si512((__i<V> *)&md4(atweights, _I2, _iV, _O2, 0), w0);
         } else {
           auto si512 = _mm<V>::load_si512(aweights);
           auto w1 = _mm<V>::and_epi32(si512, mask);
           auto sr_w1 = _mm<V>::bsrli_epi128(w1, 2);
 
-          auto w0 = _mm<V>::load_si512(
-              &md8(atweights, _oc4, _ic4, _oc3, _ic3, _I2, _iV, 0, 0));
+          auto w0 = _mm<V>::load_si512(&md4(atweights, _I2, _iV, 0, 0));
 
           auto w0w1 = _mm<V>::or_epi32(w0, sr_w1);
-          _mm<V>::store_si512((__i<V> *)&md8(atweights, _oc4, _ic4, _oc3,
-                                             _ic3, _I2, _iV, 0, 0), w0w1);
+          _mm<V>::store_si512((__i<V> *)&md4(atweights, _I2, _iV, 0, 0), w0w1);
         }
       } else {            // fp32->fp16
         auto fp16v = _mm<V>::cvtps_ph(*(__m<V> *)aweights,
             _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
         _mm<V/2>::store_si256(
-            (__i<V/2> *)&md8(atweights, _oc4, _ic4, _oc3, _ic3, _I2, _iV, _O2, 0), fp16v);
+            (__i<V/2> *)&md4(atweights, _I2, _iV, _O2, 0), fp16v);
       }
     }
   } else {
     #pragma omp simd
     iter_each (_oV, V) {
-      md8(atweights, _oc4, _ic4, _oc3, _ic3, _I2, _iV, _O2, _oV) = aweights[_oV];
+      md4(atweights, _I2, _iV, _O2, _oV) = aweights[_oV];
     }
   }
 }
@@ -437,15 +476,16 @@ Template_elx_conv_direct_1x1_t
 void Instance_elx_conv_direct_1x1_t::__trans_weights_Or_post(WeightsType *aweights,
     TweightsType *tweights, int _oc4, int _ic4, int _oc3, int _ic3, int _I2, int _iV, int _O2)
 {
-  MD8(TweightsType, atweights, tweights, this->oc4, this->ic4, this->oc3, this->ic3,
-      this->I2, V, this->O2, V);
+  MD5(TweightsType, atweights5, tweights, this->oc4, this->ic4, this->oc3,
+      this->ic3, this->O2 * this->I2 * V * V);
+  MD4(TweightsType, atweights, &md5(atweights5, _oc4, _ic4, _oc3, _ic3, 0),
+      this->I2, V, O2z(_oc4, _oc3), V);
 
   if (I == ISA_SKX_AVX512 && std::is_same<WeightsType, float>::value) {
     __mmask16 k = _mm512_int2mask(this->ormask);
     if (std::is_same<TweightsType, float>::value) {
       auto w = _mm<V>::maskz_load_ps(k, aweights);
-      _mm<V>::store_ps(
-          &md8(atweights, _oc4, _ic4, _oc3, _ic3, _I2, _iV, this->O - 1, 0), w);
+      _mm<V>::store_ps(&md4(atweights, _I2, _iV, _O2, 0), w);
     } else {
       if (this->O == 2) { // fp32 -> bf16
         // _O index in this path is 1
@@ -454,24 +494,21 @@ void Instance_elx_conv_direct_1x1_t::__trans_weights_Or_post(WeightsType *aweigh
         auto w1 = _mm<V>::and_epi32(si512, mask);
         auto sr_w1 = _mm<V>::bsrli_epi128(w1, 2);
 
-        auto w0 = _mm<V>::load_si512(&md8(atweights,
-            _oc4, _ic4, _oc3, _ic3, _I2, _iV, 0, 0));
+        auto w0 = _mm<V>::load_si512(&md4(atweights, _I2, _iV, 0, 0));
         auto w0w1 = _mm<V>::or_epi32(w0, sr_w1);
-        _mm<V>::store_si512((__i<V> *)&md8(atweights, _oc4, _ic4, _oc3,
-                                           _ic3, _I2, _iV, 0, 0), w0w1);
+        _mm<V>::store_si512((__i<V> *)&md4(atweights, _I2, _iV, 0, 0), w0w1);
       } else {            // fp32 -> fp16
         auto t = _mm<V>::maskz_load_ps(k, aweights);
         auto fp16v = _mm<V>::cvtps_ph(t,
             _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
         _mm<V/2>::store_si256(
-            (__i<V/2> *)&md8(atweights, _oc4, _ic4, _oc3, _ic3, _I2, _iV, _O2, 0), fp16v);
+            (__i<V/2> *)&md4(atweights, _I2, _iV, _O2, 0), fp16v);
       }
     }
   } else {
     #pragma omp simd
     iter_each (_oV, this->Or) {
-      md8(atweights, _oc4, _ic4, _oc3, _ic3, _I2, _iV, _O2, _oV)
-        = aweights[_oV];
+      md4(atweights, _I2, _iV, _O2, _oV) = aweights[_oV];
     }
   }
 }
@@ -484,9 +521,10 @@ void Instance_elx_conv_direct_1x1_t::__trans_weights_blocked(
   // ic4, oc4, ic3, (oc3, oc3r), I2, V, (O2, O2r), V
 
   parallel_for<4>(mthr_, [&](int _oc4, int _ic4, int _oc3, int _ic3) {
+    if (_oc3 >= oc3z(_oc4)) return;
     iter_each (_I2, this->I2) {
     iter_each (_iV, V) {
-    iter_each (_O2, this->O2) {
+    iter_each (_O2, O2z(_oc4, _oc3)) {
       MD8(WeightsType, aweights, weights, this->oc4, this->oc3, this->O2,
           this->ic4, this->ic3, this->I2, V, V);
       __trans_weights_post(&md8(aweights, _oc4, _oc3, _O2, _ic4, _ic3, _I2, _iV, 0),
@@ -505,8 +543,9 @@ void Instance_elx_conv_direct_1x1_t::__trans_weights_oihw(
 
   if (this->Ir == V && this->Or == V) {
     parallel_for<5>(mthr_, [&](int _oc4, int _ic4, int _oc3, int _ic3, int _I2) {
+      if (_oc3 >= oc3z(_oc4)) return;
       iter_each (_iV, V) {
-      iter_each (_O2, this->O2) {
+      iter_each (_O2, O2z(_oc4, _oc3)) {
         MD8(WeightsType, aweights, weights, this->oc4, this->oc3, this->O2, V,
             this->ic4, this->ic3, this->I2, V);
         constexpr int scale = sizeof(WeightsType);
@@ -551,13 +590,14 @@ void Instance_elx_conv_direct_1x1_t::__trans_weights_oihw(
     };
 
     parallel_for<5>(mthr_, [&](int _oc4, int _ic4, int _oc3, int _ic3, int _I2) {
+      if (_oc3 >= oc3z(_oc4)) return;
       bool is_Ir = (_ic4 == this->ic4 - 1) && (_ic3 == this->ic3 -1)
           && (_I2 == this->I2 - 1);
       int iV = is_Ir ? this->Ir : V;
       iter_each (_iV, iV) {
-      iter_each (_O2, this->O2) {
-        bool is_Or = (_oc4 == this->oc4 - 1) && (_oc3 == this->oc3 - 1)
-            && (_O2 == this->O2 - 1);
+      iter_each (_O2, O2z(_oc4, _oc3)) {
+        bool is_Or = (_oc4 * this->oc3 + _oc3) * this->O2 + _O2
+            == this->oc2 - 1;
         if (this->Ir != V || is_Ir || is_Or)
           readin_r(tweights, weights, _oc4, _oc3, _O2, _ic4, _ic3, _I2, _iV, is_Or);
         else
@@ -573,13 +613,13 @@ void Instance_elx_conv_direct_1x1_t::__trans_weights_hwio(
 {
   if (this->Ir == V && this->Or == V) {
     parallel_for<5>(mthr_, [&](int _oc4, int _ic4, int _oc3, int _ic3, int _I2) {
-      MD8(TweightsType, atweights, tweights, this->oc4, this->ic4, this->oc3,
-          this->ic3, this->I2, V, this->O2, V);
-      MD8(WeightsType, aweights, weights, this->ic4, this->ic3, this->I2, V,
-          this->oc4, this->oc3, this->O2, V);
+      if (_oc3 >= oc3z(_oc4)) return;
+      MD5(WeightsType, aweights, weights, this->ic4, this->ic3, this->I2, V,
+          this->oc);
       iter_each (_iV, V) {
-      iter_each (_O2, this->O2) {
-        __trans_weights_post(&md8(aweights, _ic4, _ic3, _I2, _iV, _oc4, _oc3, _O2, 0),
+      iter_each (_O2, O2z(_oc4, _oc3)) {
+        int _oc2 = (_oc4 * this->oc3 + _oc3) * this->O2 + _O2;
+        __trans_weights_post(&md5(aweights, _ic4, _ic3, _I2, _iV, _oc2 * V),
             tweights, _oc4, _ic4, _oc3, _ic3, _I2, _iV, _O2);
       }}
     }, this->oc4, this->ic4, this->oc3, this->ic3, this->I2);
@@ -589,8 +629,7 @@ void Instance_elx_conv_direct_1x1_t::__trans_weights_hwio(
       MD2(WeightsType, aweights2, weights, this->ic, this->oc);
       int _ic2 = _ic4 * this->ic3 * this->I2 + _ic3 * this->I2 + _I2;
       int _oc2 = _oc4 * this->oc3 * this->O2 + _oc3 * this->O2 + _O2;
-      bool is_Or = this->Or != V && _oc4 == this->oc4 - 1
-          && _oc3 == this->oc3 - 1 && _O2 == this->O2 - 1;
+      bool is_Or = this->Or != V && _oc2 == this->oc2 - 1;
 
       if (is_Or)
         __trans_weights_Or_post(&md2(aweights2, _ic2 * V + _iV, _oc2 * V),
@@ -601,15 +640,12 @@ void Instance_elx_conv_direct_1x1_t::__trans_weights_hwio(
     };
 
     parallel_for<5>(mthr_, [&](int _oc4, int _ic4, int _oc3, int _ic3, int _I2) {
-      MD8(TweightsType, atweights, tweights, this->oc4, this->ic4, this->oc3,
-          this->ic3, this->I2, V, this->O2, V);
-      MD8(WeightsType, aweights, weights, this->ic4, this->ic3, this->I2, V,
-          this->oc4, this->oc3, this->O2, V);
+      if (_oc3 >= oc3z(_oc4)) return;
       int iV = (this->Ir != V && _ic4 == this->ic4 - 1
           && _ic3 == this->ic3 - 1 && _I2 == this->I2 - 1)
           ? this->Ir : V;
       iter_each (_iV, iV) {
-      iter_each (_O2, this->O2) {
+      iter_each (_O2, O2z(_oc4, _oc3)) {
         readin(_oc4, _ic4, _oc3, _ic3, _I2, _iV, _O2);
       }}
     }, this->oc4, this->ic4, this->oc3, this->ic3, this->I2);
@@ -630,15 +666,15 @@ void Instance_elx_conv_direct_1x1_t::trans_weights(
 
 Template_elx_conv_direct_1x1_t
 void Instance_elx_conv_direct_1x1_t::__trans_pad_input_blocked(
-    TinputType *tinput, InputType *input, int _ht, int _wt)
+    TinputType *tinput, InputType *input, int _ht, int _wt, int Tz)
 {
-  MD4(TinputType, atinput, tinput, this->ic3, this->I2, this->T, V);
+  MD4(TinputType, atinput, tinput, this->ic3, this->I2, Tz, V);
   MD5(InputType, ainput, input, this->ic3, this->I2, this->ih, this->iw, V);
 
   int _ih = _ht * this->hs - this->tp;
   iter_each (_ic3, this->ic3) {
   iter_each (_I2, this->I2) {
-  iter_each (_T, this->T) {
+  iter_each (_T, Tz) {
     int _iw = _wt * (this->ws * this->T) + _T * this->ws - this->lp;
     if (_ih < 0 || _ih >= this->ih || _iw < 0 || _iw >= this->iw) {
 #pragma omp simd
@@ -666,28 +702,28 @@ void Instance_elx_conv_direct_1x1_t::__trans_pad_input_blocked(
 
 Template_elx_conv_direct_1x1_t
 void Instance_elx_conv_direct_1x1_t::__trans_input_blocked(
-    TinputType *tinput, InputType *input, int _ht, int _wt)
+    TinputType *tinput, InputType *input, int _ht, int _wt, int Tz)
 {
-  // ic3, I2, ht, hs, wt, T, ws, V -> ht, wt | ic3, I2, T, V
-  MD8(InputType, ainput, input, this->ic3, this->I2, this->ht, this->hs,
-      this->wt, this->T, this->ws, V);
-  MD4(TinputType, atinput, tinput, this->ic3, this->I2, this->T, V);
+  // ic3, I2, ih, iw, V -> ht, wt | ic3, I2, T(Tr), V
+  MD5(InputType, ainput, input, this->ic3, this->I2, this->ih, this->iw, V);
+  MD4(TinputType, atinput, tinput, this->ic3, this->I2, Tz, V);
 
+  int _ih = _ht * this->hs;
   iter_each (_ic3, this->ic3) {
   iter_each (_I2, this->I2) {
-  iter_each (_T, this->T) {
+  iter_each (_T, Tz) {
+    int _iw = (_wt * this->T + _T) * this->ws;
     if (I == ISA_SKX_AVX512 && std::is_same<InputType, float>::value) {
       if (stream_in_)
         _mm<V>::stream_ps(&md4(atinput, _ic3, _I2, _T, 0),
-             *((__m<V> *)&md8(ainput, _ic3, _I2, _ht, 0, _wt, _T, 0, 0)));
+             *((__m<V> *)&md5(ainput, _ic3, _I2, _ih, _iw, 0)));
       else
         _mm<V>::store_ps(&md4(atinput, _ic3, _I2, _T, 0),
-             *((__m<V> *)&md8(ainput, _ic3, _I2, _ht, 0, _wt, _T, 0, 0)));
+             *((__m<V> *)&md5(ainput, _ic3, _I2, _ih, _iw, 0)));
     } else {
       #pragma omp simd
       iter_each (_V, V) {
-        md4(atinput, _ic3, _I2, _T, _V)
-            = md8(ainput, _ic3, _I2, _ht, 0, _wt, _T, 0, _V);
+        md4(atinput, _ic3, _I2, _T, _V) = md5(ainput, _ic3, _I2, _ih, _iw, _V);
       }
     }
   }}}
@@ -695,16 +731,16 @@ void Instance_elx_conv_direct_1x1_t::__trans_input_blocked(
 
 Template_elx_conv_direct_1x1_t
 void Instance_elx_conv_direct_1x1_t::__trans_pad_input_plain(
-    TinputType *tinput, InputType *input, int _ht, int _wt)
+    TinputType *tinput, InputType *input, int _ht, int _wt, int Tz)
 {
-  MD3(TinputType, atinput, tinput, this->ic3 * this->I2, this->T, V);
+  MD3(TinputType, atinput, tinput, this->ic3 * this->I2, Tz, V);
   SET_EPI32(this->ih * this->iw)
   if (this->Ir == V) {
     MD4(InputType, ainput, input, this->ic3 * this->I2, V, this->ih, this->iw);
 
     int _ih = _ht * this->hs - this->tp;
     iter_each (_ic2, this->ic3 * this->I2) {
-    iter_each (_T, this->T) {
+    iter_each (_T, Tz) {
       int _iw = _wt * (this->ws * this->T) + _T * this->ws - this->lp;
       if (_ih < 0 || _ih >= this->ih || _iw < 0 || _iw >= this->iw) {
         #pragma omp simd
@@ -730,7 +766,7 @@ void Instance_elx_conv_direct_1x1_t::__trans_pad_input_plain(
 
     int _ih = _ht * this->hs - this->tp;
     iter_each (_ic2, this->ic3 * this->I2) {
-    iter_each (_T, this->T) {
+    iter_each (_T, Tz) {
       int _iw = _wt * (this->ws * this->T) + _T * this->ws - this->lp;
       bool is_Ir = _ic2 == this->ic2 - 1;
       if (is_Ir) {
@@ -773,52 +809,52 @@ void Instance_elx_conv_direct_1x1_t::__trans_pad_input_plain(
 
 Template_elx_conv_direct_1x1_t
 void Instance_elx_conv_direct_1x1_t::__trans_input_nchw(
-    TinputType *tinput, InputType *input, int _ht, int _wt)
+    TinputType *tinput, InputType *input, int _ht, int _wt, int Tz)
 {
-  // ic3, I2, V, ht, hs, wt, T, ws -> ht, wt | ic3, I2, T, V
-  MD3(TinputType, atinput, tinput, this->ic3 * this->I2, this->T, V);
+  // ic3, I2, V, ih, iw -> ht, wt | ic3, I2, T(Tr), V
+  MD3(TinputType, atinput, tinput, this->ic3 * this->I2, Tz, V);
   SET_EPI32(this->ih * this->iw)
+  int _ih = _ht * this->hs;
   if (this->Ir == V) {
-    MD7(InputType, ainput, input, this->ic3 * this->I2, V, this->ht,
-        this->hs, this->wt, this->T, this->ws);
+    MD4(InputType, ainput, input, this->ic3 * this->I2, V, this->ih, this->iw);
     iter_each (_ic2, this->ic3 * this->I2) {
-    iter_each (_T, this->T) {
+    iter_each (_T, Tz) {
+      int _iw = (_wt * this->T + _T) * this->ws;
       if (I == ISA_SKX_AVX512 && std::is_same<InputType, float>::value) {
          constexpr int scale = sizeof(InputType);
          __m<V> ain = _mm<V>::i32gather_ps(vindex,
-             &md7(ainput, _ic2, 0, _ht, 0, _wt, _T, 0), scale);
+             &md4(ainput, _ic2, 0, _ih, _iw), scale);
          _mm<V>::store_ps(&md3(atinput, _ic2, _T, 0), ain);
       } else {
         #pragma omp simd
         iter_each (_V, V) {
-          md3(atinput, _ic2, _T, _V)
-              = md7(ainput, _ic2, _V, _ht, 0, _wt, _T, 0);
+          md3(atinput, _ic2, _T, _V) = md4(ainput, _ic2, _V, _ih, _iw);
         }
       }
     }}
   } else {
-    MD6(InputType, ainput6, input, this->ic, this->ht, this->hs,
-        this->wt, this->T, this->ws);
+    MD3(InputType, ainput3, input, this->ic, this->ih, this->iw);
     iter_each (_ic2, this->ic3 * this->I2) {
-    iter_each (_T, this->T) {
+    iter_each (_T, Tz) {
+      int _iw = (_wt * this->T + _T) * this->ws;
       bool is_Ir = _ic2 == this->ic2 - 1;
       if (is_Ir) {
         #pragma omp simd
         iter_each (_V, this->Ir) {
           md3(atinput, _ic2, _T, _V)
-              = md6(ainput6, (this->ic2 - 1) * V + _V, _ht, 0, _wt, _T, 0);
+              = md3(ainput3, (this->ic2 - 1) * V + _V, _ih, _iw);
         }
       } else {
         if (I == ISA_SKX_AVX512 && std::is_same<InputType, float>::value) {
           constexpr int scale = sizeof(InputType);
           __m<V> ain = _mm<V>::i32gather_ps(vindex,
-              &md6(ainput6, _ic2 * V, _ht, 0, _wt, _T, 0), scale);
+              &md3(ainput3, _ic2 * V, _ih, _iw), scale);
           _mm<V>::store_ps(&md3(atinput, _ic2, _T, 0), ain);
         } else {
           #pragma omp simd
           iter_each (_V, V) {
             md3(atinput, _ic2, _T, _V)
-                = md6(ainput6, _ic2 * V + _V, _ht, 0, _wt, _T, 0);
+                = md3(ainput3, _ic2 * V + _V, _ih, _iw);
           }
         }
       }
@@ -828,51 +864,52 @@ void Instance_elx_conv_direct_1x1_t::__trans_input_nchw(
 
 Template_elx_conv_direct_1x1_t
 void Instance_elx_conv_direct_1x1_t::trans_input(
-    TinputType *tinput, InputType *input, int _ht, int _wt)
+    TinputType *tinput, InputType *input, int _ht, int _wt, int Tz)
 {
   if (no_pad_) {
     if (input_is_bfmt_ || input_as_bfmt_)
-      __trans_input_blocked(tinput, input, _ht, _wt);
+      __trans_input_blocked(tinput, input, _ht, _wt, Tz);
     else
-      __trans_input_nchw(tinput, input, _ht, _wt);
+      __trans_input_nchw(tinput, input, _ht, _wt, Tz);
   } else {
     if (input_is_bfmt_ || input_as_bfmt_)
-      __trans_pad_input_blocked(tinput, input, _ht, _wt);
+      __trans_pad_input_blocked(tinput, input, _ht, _wt, Tz);
     else
-      __trans_pad_input_plain(tinput, input, _ht, _wt);
+      __trans_pad_input_plain(tinput, input, _ht, _wt, Tz);
   }
 }
 
 
 Template_elx_conv_direct_1x1_t
 void Instance_elx_conv_direct_1x1_t::__trans_output_blocked(
-    OutputType *output, ToutputType *toutput, int _oc4, int _ht, int _wt)
+    OutputType *output, ToutputType *toutput, int _oc4, int _ht, int _wt, int Tz)
 {
-  // oc3, O2, T, V => n, oc4 | oc3, O2, ht, wt, T, V
-  MD4(ToutputType, atoutput, toutput, this->oc3, this->O2, this->T, V);
-  MD7(OutputType, aoutput, output, this->oc4, this->oc3, this->O2,
-      this->ht, this->wt, this->T, V);
+  // oc3, O2, T(Tr), V => n, oc4 | oc3, O2, oh, ow, V
+  MD4(ToutputType, atoutput, toutput, this->oc3, this->O2, Tz, V);
+  MD6(OutputType, aoutput, output, this->oc4, this->oc3, this->O2,
+      this->oh, this->ow, V);
 
-  iter_each (_oc3, this->oc3) {
-  iter_each (_O2, this->O2) {
-  iter_each (_T, this->T) {
+  iter_each (_oc3, oc3z(_oc4)) {
+  iter_each (_O2, O2z(_oc4, _oc3)) {
+  iter_each (_T, Tz) {
+    int _ow = _wt * this->T + _T;
     if (this->with_ip_sum && !output_as_bfmt_) {
       #pragma omp simd
       iter_each (_V, V) {
-        md7(aoutput, _oc4, _oc3, _O2, _ht, _wt, _T, _V)
+        md6(aoutput, _oc4, _oc3, _O2, _ht, _ow, _V)
             += md4(atoutput, _oc3, _O2, _T, _V);
       }
     } else if (I == ISA_SKX_AVX512 && std::is_same<OutputType, float>::value) {
       if (stream_out_)
-        _mm<V>::stream_ps(&md7(aoutput, _oc4, _oc3, _O2, _ht, _wt, _T, 0),
+        _mm<V>::stream_ps(&md6(aoutput, _oc4, _oc3, _O2, _ht, _ow, 0),
              *((__m<V> *)&md4(atoutput, _oc3, _O2, _T, 0)));
       else
-        _mm<V>::store_ps(&md7(aoutput, _oc4, _oc3, _O2, _ht, _wt, _T, 0),
+        _mm<V>::store_ps(&md6(aoutput, _oc4, _oc3, _O2, _ht, _ow, 0),
              *((__m<V> *)&md4(atoutput, _oc3, _O2, _T, 0)));
     } else {
       #pragma omp simd
       iter_each (_V, V) {
-        md7(aoutput, _oc4, _oc3, _O2, _ht, _wt, _T, _V)
+        md6(aoutput, _oc4, _oc3, _O2, _ht, _ow, _V)
             = md4(atoutput, _oc3, _O2, _T, _V);
       }
     }
@@ -881,75 +918,88 @@ void Instance_elx_conv_direct_1x1_t::__trans_output_blocked(
 
 Template_elx_conv_direct_1x1_t
 void Instance_elx_conv_direct_1x1_t::__trans_output_nchw(
-    OutputType *output, ToutputType *toutput, int _oc4, int _ht, int _wt)
+    OutputType *output, ToutputType *toutput, int _oc4, int _ht, int _wt, int Tz)
 {
-  // oc3, O2, T, V => n, oc4 | oc3, O2, V, ht, wt, T
+  // oc3, O2, T(Tr), V => n, oc4 | oc3, O2, V, oh, ow
   SET_EPI32(this->oh * this->ow)
   if (this->Or == V) {
-    MD4(ToutputType, atoutput, toutput, this->oc3, this->O2, this->T, V);
-    MD7(OutputType, aoutput, output, this->oc4, this->oc3, this->O2, V,
-        this->ht, this->wt, this->T);
-    iter_each (_oc3, this->oc3) {
-    iter_each (_O2, this->O2) {
-    iter_each (_T, this->T) {
-      if (this->with_ip_sum && !output_as_bfmt_) {
+    MD4(ToutputType, atoutput, toutput, this->oc3, this->O2, Tz, V);
+    MD6(OutputType, aoutput, output, this->oc4, this->oc3, this->O2, V,
+        this->oh, this->ow);
+    iter_each (_oc3, oc3z(_oc4)) {
+    iter_each (_O2, O2z(_oc4, _oc3)) {
+    iter_each (_T, Tz) {
+      int _ow = _wt * this->T + _T;
+      if (act_after_sum_) {
+        this->template sum_activate_plain<V>(
+            (float *)&md6(aoutput, _oc4, _oc3, _O2, 0, _ht, _ow), vindex,
+            *(__m<V> *)&md4(atoutput, _oc3, _O2, _T, 0));
+      } else if (this->with_ip_sum && !output_as_bfmt_) {
         #pragma omp simd
         iter_each (_V, V) {
-          md7(aoutput, _oc4, _oc3, _O2, _V, _ht, _wt, _T)
+          md6(aoutput, _oc4, _oc3, _O2, _V, _ht, _ow)
               += md4(atoutput, _oc3, _O2, _T, _V);
         }
       } else if (I == ISA_SKX_AVX512 && std::is_same<OutputType, float>::value) {
         __m<V> t = _mm<V>::load_ps(&md4(atoutput, _oc3, _O2, _T, 0));
         constexpr int scale = sizeof(OutputType);
-        _mm<V>::i32scatter_ps(&md7(aoutput, _oc4, _oc3, _O2, 0, _ht, _wt, _T),
+        _mm<V>::i32scatter_ps(&md6(aoutput, _oc4, _oc3, _O2, 0, _ht, _ow),
             vindex, t, scale);
       } else {
         #pragma omp simd
         iter_each (_V, V) {
-          md7(aoutput, _oc4, _oc3, _O2, _V, _ht, _wt, _T)
+          md6(aoutput, _oc4, _oc3, _O2, _V, _ht, _ow)
               = md4(atoutput, _oc3, _O2, _T, _V);
         }
       }
     }}}
   } else {
-    MD4(OutputType, atoutput, toutput, this->oc3, this->O2, this->T, V);
-    MD4(OutputType, aoutput, output, this->oc, this->ht, this->wt, this->T);
-    iter_each (_oc3, this->oc3) {
-    iter_each (_O2, this->O2) {
-    iter_each (_T, this->T) {
+    MD4(OutputType, atoutput, toutput, this->oc3, this->O2, Tz, V);
+    MD3(OutputType, aoutput, output, this->oc, this->oh, this->ow);
+    iter_each (_oc3, oc3z(_oc4)) {
+    iter_each (_O2, O2z(_oc4, _oc3)) {
+    iter_each (_T, Tz) {
+      int _ow = _wt * this->T + _T;
       int _oc2 = _oc4 * this->oc3 * this->O2 + _oc3 * this->O2 + _O2;
-      bool is_Or = (_oc4 == this->oc4 - 1) && (_oc3 == this->oc3 - 1)
-          && (_O2 == this->O2 - 1);
+      bool is_Or = _oc2 == this->oc2 - 1;
       if (is_Or) {
-        if (this->with_ip_sum && !output_as_bfmt_) {
+        if (act_after_sum_) {
+          this->template sum_activate_plain<V>(
+              (float *)&md3(aoutput, (this->oc2 - 1) * V, _ht, _ow),
+              vindex, *(__m<V> *)&md4(atoutput, _oc3, _O2, _T, 0), this->Or);
+        } else if (this->with_ip_sum && !output_as_bfmt_) {
           #pragma omp simd
           iter_each(_ov, this->Or) {
-            md4(aoutput, (this->oc2 - 1) * V + _ov, _ht, _wt, _T)
+            md3(aoutput, (this->oc2 - 1) * V + _ov, _ht, _ow)
                 += md4(atoutput, _oc3, _O2, _T, _ov);
           }
         } else {
           #pragma omp simd
           iter_each(_ov, this->Or) {
-            md4(aoutput, (this->oc2 - 1) * V + _ov, _ht, _wt, _T)
+            md3(aoutput, (this->oc2 - 1) * V + _ov, _ht, _ow)
                 = md4(atoutput, _oc3, _O2, _T, _ov);
           }
         }
       } else {
-        if (this->with_ip_sum && !output_as_bfmt_) {
+        if (act_after_sum_) {
+          this->template sum_activate_plain<V>(
+              (float *)&md3(aoutput, _oc2 * V, _ht, _ow), vindex,
+              *(__m<V> *)&md4(atoutput, _oc3, _O2, _T, 0));
+        } else if (this->with_ip_sum && !output_as_bfmt_) {
           #pragma omp simd
           iter_each(_V, V) {
-            md4(aoutput, _oc2 * V + _V, _ht, _wt, _T)
+            md3(aoutput, _oc2 * V + _V, _ht, _ow)
                 += md4(atoutput, _oc3, _O2, _T, _V);
           }
         } else if (I == ISA_SKX_AVX512 && std::is_same<OutputType, float>::value) {
           __m<V> t = _mm<V>::load_ps(&md4(atoutput, _oc3, _O2, _T, 0));
           constexpr int scale = sizeof(OutputType);
-          _mm<V>::i32scatter_ps(&md4(aoutput, _oc2 * V, _ht, _wt, _T), vindex,
+          _mm<V>::i32scatter_ps(&md3(aoutput, _oc2 * V, _ht, _ow), vindex,
               t, scale);
         } else {
           #pragma omp simd
           iter_each(_V, V) {
-            md4(aoutput, _oc2 * V + _V, _ht, _wt, _T)
+            md3(aoutput, _oc2 * V + _V, _ht, _ow)
                 = md4(atoutput, _oc3, _O2, _T, _V);
           }
         }
@@ -960,12 +1010,12 @@ void Instance_elx_conv_direct_1x1_t::__trans_output_nchw(
 
 Template_elx_conv_direct_1x1_t
 void Instance_elx_conv_direct_1x1_t::trans_output(
-    OutputType *output, ToutputType *toutput, int _oc4, int _ht, int _wt)
+    OutputType *output, ToutputType *toutput, int _oc4, int _ht, int _wt, int Tz)
 {
   if (output_is_bfmt_ || output_as_bfmt_)
-    __trans_output_blocked(output, toutput, _oc4, _ht, _wt);
+    __trans_output_blocked(output, toutput, _oc4, _ht, _wt, Tz);
   else
-    __trans_output_nchw(output, toutput, _oc4, _ht, _wt);
+    __trans_output_nchw(output, toutput, _oc4, _ht, _wt, Tz);
 }
 
 Template_elx_conv_direct_1x1_t
@@ -1066,10 +1116,14 @@ void Instance_elx_conv_direct_1x1_t::__trans_output_plain2(
     MD4(ToutputType, atoutput, toutput, this->oc3, this->O2, Tz, V);
     MD5(OutputType, aoutput, output, this->oc4, this->oc3, this->O2, V,
         this->oh * this->ow);
-    iter_each (_oc3, this->oc3) {
-    iter_each (_O2, this->O2) {
+    iter_each (_oc3, oc3z(_oc4)) {
+    iter_each (_O2, O2z(_oc4, _oc3)) {
     iter_each (_T, Tz) {
-      if (this->with_ip_sum && !output_as_bfmt_) {
+      if (act_after_sum_) {
+        this->template sum_activate_plain<V>(
+            (float *)&md5(aoutput, _oc4, _oc3, _O2, 0, _t2 * this->T + _T),
+            vindex, *(__m<V> *)&md4(atoutput, _oc3, _O2, _T, 0));
+      } else if (this->with_ip_sum && !output_as_bfmt_) {
         #pragma omp simd
         iter_each (_V, V) {
           md5(aoutput, _oc4, _oc3, _O2, _V, _t2 * this->T + _T)
@@ -1091,14 +1145,17 @@ void Instance_elx_conv_direct_1x1_t::__trans_output_plain2(
   } else {
     MD4(ToutputType, atoutput, toutput, this->oc3, this->O2, Tz, V);
     MD2(OutputType, aoutput, output, this->oc, this->oh * this->ow);
-    iter_each (_oc3, this->oc3) {
-    iter_each (_O2, this->O2) {
+    iter_each (_oc3, oc3z(_oc4)) {
+    iter_each (_O2, O2z(_oc4, _oc3)) {
     iter_each (_T, Tz) {
       int _oc2 = _oc4 * this->oc3 * this->O2 + _oc3 * this->O2 + _O2;
-      bool is_Or = (_oc4 == this->oc4 - 1) && (_oc3 == this->oc3 - 1)
-          && (_O2 == this->O2 - 1);
+      bool is_Or = _oc2 == this->oc2 - 1;
       if (is_Or) {
-        if (this->with_ip_sum && !output_as_bfmt_) {
+        if (act_after_sum_) {
+          this->template sum_activate_plain<V>(
+              (float *)&md2(aoutput, (this->oc2 - 1) * V, _t2 * this->T + _T),
+              vindex, *(__m<V> *)&md4(atoutput, _oc3, _O2, _T, 0), this->Or);
+        } else if (this->with_ip_sum && !output_as_bfmt_) {
           #pragma omp simd
           iter_each(_ov, this->Or) {
             md2(aoutput, (this->oc2 - 1) * V + _ov, _t2 * this->T + _T)
@@ -1112,7 +1169,11 @@ void Instance_elx_conv_direct_1x1_t::__trans_output_plain2(
           }
         }
       } else {
-        if (this->with_ip_sum && !output_as_bfmt_) {
+        if (act_after_sum_) {
+          this->template sum_activate_plain<V>(
+              (float *)&md2(aoutput, _oc2 * V, _t2 * this->T + _T), vindex,
+              *(__m<V> *)&md4(atoutput, _oc3, _O2, _T, 0));
+        } else if (this->with_ip_sum && !output_as_bfmt_) {
           #pragma omp simd
           iter_each(_V, V) {
             md2(aoutput, _oc2 * V + _V, _t2 * this->T + _T)
@@ -1144,8 +1205,8 @@ void Instance_elx_conv_direct_1x1_t::__trans_output_blocked2(
   MD5(OutputType, aoutput, output, this->oc4, this->oc3, this->O2,
       this->oh * this->ow, V);
 
-  iter_each (_oc3, this->oc3) {
-  iter_each (_O2, this->O2) {
+  iter_each (_oc3, oc3z(_oc4)) {
+  iter_each (_O2, O2z(_oc4, _oc3)) {
   iter_each (_T, Tz) {
     if (this->with_ip_sum && !output_as_bfmt_) {
       #pragma omp simd
@@ -1182,94 +1243,56 @@ void Instance_elx_conv_direct_1x1_t::trans_output2(
 
 Template_elx_conv_direct_1x1_t
 void Instance_elx_conv_direct_1x1_t::gemm_a061(ToutputType *output,
-    TinputType *input, TweightsType *weights, BiasType *bias, int _ic4)
+    TinputType *input, TweightsType *weights, BiasType *bias,
+    int _ic4, int _oc4, int Tz, bool partial)
 {
-  // weights: oc3*, ic3*, O2, I2, V, V
-  // input:   ic3*, I2, [T], V
-  // output:  oc3*, O2, [T], V
+  // a061, f061
+  // weights: oc3*, ic3*, O2(O2r), I2, V, V
+  // input:   ic3*, I2, [T(Tr)], V
+  // output:  oc3*, O2(O2r), [T(Tr)], V
+  // nhwc: input/output of the tile in user tensors, pixel strided
+  const int tz = this->input_fmt == nhwc ? 1 : Tz;
+  MD2(TinputType, ainput, input, this->ic3, this->I2 * tz * V);
+  MD2(ToutputType, aoutput, output, this->oc3, this->O2 * tz * V);
   MD3(TweightsType, aweights, weights, this->oc3, this->ic3,
       this->O2 * this->I2 * V * V);
   MD2(BiasType, abias, bias, this->oc3, this->O2 * V);
 
-  if (this->input_fmt == nhwc) {
-    MD2(TinputType, ainput, input, this->ic3, this->I2 * V);
-    MD2(ToutputType, aoutput, output, this->oc3, this->O2 * V);
-    iter_each (_ic3, this->ic3 - 1) {
-      int attr
-          = _ic4 == 0 && _ic3 == 0
-          ? set_attr(attr_, r_output_idx)
-          : attr_;
-      iter_each (_oc3, this->oc3) {
-        ker_gemm_I_O_T_(
-            *this,
-            &md2(aoutput, _oc3, 0),
-            &md2(ainput, _ic3, 0),
-            &md3(aweights, _oc3, _ic3, 0),
-            &md2(abias, _oc3, 0), attr);
-      }
-    }
-    int attr
-        = _ic4 == 0 && this->ic3 == 1
-        ? set_attr(attr_, r_output_idx)
-        : attr_;
-    if (_ic4 == this->ic4 - 1) {
-      if (this->Ir != V) attr = set_attr(attr, has_Ir_idx);
-      if (this->with_relu) attr = set_attr(attr, relu_idx);
-    }
-    iter_each (_oc3, this->oc3) {
-      ker_gemm_I_O_T_(
-          *this,
-          &md2(aoutput, _oc3, 0),
-          &md2(ainput, this->ic3 - 1, 0),
-          &md3(aweights, _oc3, this->ic3 - 1, 0),
-          &md2(abias, _oc3, 0), attr);
-    }
-  } else { // nchw
-    MD2(TinputType, ainput, input, this->ic3, this->I2 * this->T * V);
-    MD2(ToutputType, aoutput, output, this->oc3, this->O2 * this->T * V);
-    iter_each (_ic3, this->ic3 - 1) {
-      int attr
-          = _ic4 == 0 && _ic3 == 0
-          ? set_attr(attr_, r_output_idx)
-          : attr_;
-      iter_each (_oc3, this->oc3) {
-        ker_gemm_I_O_T_(
-            *this,
-            &md2(aoutput, _oc3, 0),
-            &md2(ainput, _ic3, 0),
-            &md3(aweights, _oc3, _ic3, 0),
-            &md2(abias, _oc3, 0), attr);
-      }
-    }
+  iter_each (_ic3, this->ic3) {
     int attr
-        = _ic4 == 0 && this->ic3 == 1
+        = _ic4 == 0 && _ic3 == 0
         ? set_attr(attr_, r_output_idx)
         : attr_;
-    if (_ic4 == this->ic4 - 1) {
+    // K-split partial: sum of the slice only, epilogue by add_partial
+    if (partial)
+      attr = _ic3 == 0 ? set_attr(0x0, r_output_idx) : 0x0;
+    if (_ic4 == this->ic4 - 1 && _ic3 == this->ic3 - 1) {
       if (this->Ir != V) attr = set_attr(attr, has_Ir_idx);
-      if (this->with_relu) attr = set_attr(attr, relu_idx);
+      if (this->with_relu && !act_after_sum_ && !partial)
+        attr = set_attr(attr, relu_idx);
     }
-    iter_each (_oc3, this->oc3) {
-      ker_gemm_I_O_T_(
+    iter_each (_oc3, oc3z(_oc4)) {
+      ker_gemm(_oc4, _oc3, Tz)(
           *this,
           &md2(aoutput, _oc3, 0),
-          &md2(ainput, this->ic3 - 1, 0),
-          &md3(aweights, _oc3, this->ic3 - 1, 0),
-          &md2(abias, _oc3, 0), attr);
+          &md2(ainput, _ic3, 0),
+          &md3(aweights, _oc3, _ic3, 0),
+          &md2(abias, _oc3, 0), oc_attr(attr, _oc4, _oc3));
     }
   }
 }
 
 Template_elx_conv_direct_1x1_t
 void Instance_elx_conv_direct_1x1_t::gemm_b061(OutputType *output,
-    TinputType *input, TweightsType *weights, BiasType *bias, int _ic4)
+    TinputType *input, TweightsType *weights, BiasType *bias,
+    int _ic4, int _oc4, int Tz)
 {
-  // weights: oc3*, ic3*, O2, I2, V, V
-  // input:   ic3*, I2, T, V
-  // output:  oc3*, O2, ht*, wt*, T, V
-  MD2(TinputType, ainput, input, this->ic3, this->I2 * this->T * V);
-  MD5(OutputType, aoutput, output, this->oc3, this->O2,
-      this->ht, this->wt, this->T * V);
+  // weights: oc3*, ic3*, O2(O2r), I2, V, V
+  // input:   ic3*, I2, T(Tr), V
+  // output:  oc3*, O2(O2r), oh, ow, V
+  MD2(TinputType, ainput, input, this->ic3, this->I2 * Tz * V);
+  MD2(OutputType, aoutput, output, this->oc3,
+      this->O2 * this->oh * this->ow * V);
   MD3(TweightsType, aweights, weights, this->oc3, this->ic3,
       this->O2 * this->I2 * V * V);
   MD2(BiasType, abias, bias, this->oc3, this->O2 * V);
@@ -1283,10 +1306,10 @@ void Instance_elx_conv_direct_1x1_t::gemm_b061(OutputType *output,
         = this->with_relu && _ic4 == this->ic4 - 1 && _ic3 == this->ic3 - 1
         ? set_attr(attr, relu_idx)
         : attr;
-    iter_each (_oc3, this->oc3) {
-      ker_gemm_I_O_T_(
+    iter_each (_oc3, oc3z(_oc4)) {
+      ker_gemm(_oc4, _oc3, Tz)(
           *this,
-          &md5(aoutput, _oc3, 0, 0, 0, 0),
+          &md2(aoutput, _oc3, 0),
           &md2(ainput, _ic3, 0),
           &md3(aweights, _oc3, _ic3, 0),
           &md2(abias, _oc3, 0), attr);
@@ -1294,85 +1317,20 @@ void Instance_elx_conv_direct_1x1_t::gemm_b061(OutputType *output,
   }
 }
 
-Template_elx_conv_direct_1x1_t
-void Instance_elx_conv_direct_1x1_t::gemm_f061(ToutputType *output,
-    TinputType *input, TweightsType *weights, BiasType *bias, int _t2, int Tz)
-{
-  MD3(TweightsType, aweights, weights, this->oc3, this->ic3,
-      this->O2 * this->I2 * V * V);
-  MD2(BiasType, abias, bias, this->oc3, this->O2 * V);
-
-  auto ker_gemm = (_t2 == this->t2 - 1) ? ker_gemm_I_O_Tr_ : ker_gemm_I_O_T_;
-
-  if (this->input_fmt == nhwc) {
-    MD2(TinputType, ainput, input, this->ic3, this->I2 * V);
-    MD2(ToutputType, aoutput, output, this->oc3, this->O2 * V);
-    iter_each (_ic3, this->ic3 - 1) {
-      int attr = _ic3 == 0 ? set_attr(attr_, r_output_idx) : attr_;
-      iter_each (_oc3, this->oc3) {
-        ker_gemm(
-            *this,
-            &md2(aoutput, _oc3, 0),
-            &md2(ainput, _ic3, 0),
-            &md3(aweights, _oc3, _ic3, 0),
-            &md2(abias, _oc3, 0), attr);
-      }
-    }
-    int attr = this->ic3 == 1 ? set_attr(attr_, r_output_idx) : attr_;
-    if (this->Ir != V) attr = set_attr(attr, has_Ir_idx);
-    if (this->with_relu) attr = set_attr(attr, relu_idx);
-    iter_each(_oc3, this->oc3) {
-      ker_gemm(
-          *this,
-          &md2(aoutput, _oc3, 0),
-          &md2(ainput, this->ic3 - 1, 0),
-          &md3(aweights, _oc3, this->ic3 - 1, 0),
-          &md2(abias, _oc3, 0), attr);
-    }
-  } else { // nchw
-    MD2(TinputType, ainput, input, this->ic3, this->I2 * Tz * V);
-    MD2(ToutputType, aoutput, output, this->oc3, this->O2 * Tz * V);
-    iter_each (_ic3, this->ic3 - 1) {
-      int attr = _ic3 == 0 ? set_attr(attr_, r_output_idx) : attr_;
-      iter_each (_oc3, this->oc3) {
-        ker_gemm(
-            *this,
-            &md2(aoutput, _oc3, 0),
-            &md2(ainput, _ic3, 0),
-            &md3(aweights, _oc3, _ic3, 0),
-            &md2(abias, _oc3, 0), attr);
-      }
-    }
-    int attr = this->ic3 == 1 ? set_attr(attr_, r_output_idx) : attr_;
-    if (this->Ir != V) attr = set_attr(attr, has_Ir_idx);
-    if (this->with_relu) attr = set_attr(attr, relu_idx);
-    iter_each(_oc3, this->oc3) {
-      ker_gemm(
-          *this,
-          &md2(aoutput, _oc3, 0),
-          &md2(ainput, this->ic3 - 1, 0),
-          &md3(aweights, _oc3, this->ic3 - 1, 0),
-          &md2(abias, _oc3, 0), attr);
-    }
-  }
-}
-
 Template_elx_conv_direct_1x1_t
 void Instance_elx_conv_direct_1x1_t::gemm_c060(OutputType *output,
     InputType *input, TweightsType *weights, BiasType *bias,
-    int _ic4, int _oc4, int _t2)
+    int _ic4, int _oc4, int Tz)
 {
-  // weights: oc3, O2, ic4*, ic3, I2, V, V
-  // input:   ic3, I2, t2*, T(Tr), V
-  // output:  oc3, O2, t2*, T(Tr), V
+  // weights: oc3, O2(O2r), ic4*, ic3, I2, V, V
+  // input:   ic3, I2, ih, iw, V, at first pixel of the tile
+  // output:  oc3, O2(O2r), oh, ow, V, at first pixel of the tile
   MD2(InputType, ainput, input, this->ic3, this->I2 * this->ih * this->iw * V);
   MD2(OutputType, aoutput, output, this->oc3, this->O2 * this->oh * this->ow * V);
   MD3(TweightsType, aweights, weights, this->oc3, this->ic3,
       this->O2 * this->I2 * V * V);
   MD2(BiasType, abias, bias, this->oc3, this->O2 * V);
 
-  auto ker_gemm = (_t2 == this->t2 - 1) ? ker_gemm_I_O_Tr_ : ker_gemm_I_O_T_;
-
   iter_each (_ic3, this->ic3) {
     int attr
         = _ic4 == 0 && _ic3 == 0
@@ -1382,17 +1340,87 @@ void Instance_elx_conv_direct_1x1_t::gemm_c060(OutputType *output,
         = this->with_relu && _ic4 == this->ic4 - 1 && _ic3 == this->ic3 - 1
         ? set_attr(attr, relu_idx)
         : attr;
-    MD2(InputType, ainput2, &md2(ainput, _ic3, 0), this->t2, this->T * V);
-    iter_each (_oc3, this->oc3) {
-      MD2(OutputType, aoutput2, &md2(aoutput, _oc3, 0), this->t2, this->T * V);
-      ker_gemm(
+    iter_each (_oc3, oc3z(_oc4)) {
+      ker_gemm(_oc4, _oc3, Tz)(
           *this,
-          &md2(aoutput2, _t2, 0),
-          &md2(ainput2, _t2, 0),
+          &md2(aoutput, _oc3, 0),
+          &md2(ainput, _ic3, 0),
           &md3(aweights, _oc3, _ic3, 0),
           &md2(abias, _oc3, 0), attr);
     }
   }
 }
 
+// Output pixels on padding, row _ht, columns [ows, owe) of oc4 block _oc4:
+// bias, sum and activation only
+Template_elx_conv_direct_1x1_t
+void Instance_elx_conv_direct_1x1_t::pad_output(OutputType *output,
+    BiasType *bias, int _oc4, int _ht, int ows, int owe)
+{
+  // output: oh, ow, oc (nhwc) | oc2, oh, ow, V (blocked)
+  MD3(float, aoutput_nhwc, (float *)output, this->oh, this->ow, this->oc);
+  MD4(float, aoutput_blocked, (float *)output, this->oc2, this->oh,
+      this->ow, V);
+  __mmask16 k = _cvtu32_mask16(this->ormask);
+
+  iter_each (_oc3, oc3z(_oc4)) {
+  iter_each (_O2, O2z(_oc4, _oc3)) {
+    int _oc2 = (_oc4 * this->oc3 + _oc3) * this->O2 + _O2;
+    bool is_Or = this->Or != V && _oc2 == this->oc2 - 1;
+    bool masked = is_Or && this->output_fmt == nhwc;
+    __m<V> mmbias = _mm<V>::setzero_ps();
+    if (this->with_bias)
+      mmbias = is_Or ? _mm512_maskz_loadu_ps(k, &bias[_oc2 * V])
+                     : _mm<V>::loadu_ps(&bias[_oc2 * V]);
+    for (int _ow = ows; _ow < owe; ++_ow) {
+      float *aout = this->output_fmt == nhwc
+          ? &md3(aoutput_nhwc, _ht, _ow, _oc2 * V)
+          : &md4(aoutput_blocked, _oc2, _ht, _ow, 0);
+      __m<V> mmout = mmbias;
+      if (this->with_ip_sum)
+        mmout += masked ? _mm512_maskz_loadu_ps(k, aout)
+                        : _mm<V>::loadu_ps(aout);
+      if (this->with_relu)
+        mmout = this->template activate<V>(mmout);
+      if (masked)
+        _mm512_mask_storeu_ps(aout, k, mmout);
+      else
+        _mm512_storeu_ps(aout, mmout);
+    }
+  }}
+}
+
+// K-split: partial of an ic4 slice, Tz pixels of oc4 block _oc4 (nhwc,
+// output and toutput at the block), added to output; activation by the
+// last slice
+Template_elx_conv_direct_1x1_t
+void Instance_elx_conv_direct_1x1_t::add_partial(OutputType *output,
+    ToutputType *toutput, int _oc4, int Tz, bool last)
+{
+  // output, toutput: Tz, oc
+  MD2(float, aoutput, (float *)output, Tz, this->oc);
+  MD2(float, atoutput, (float *)toutput, Tz, this->oc);
+  __mmask16 k = _cvtu32_mask16(this->ormask);
+
+  iter_each (_oc3, oc3z(_oc4)) {
+  iter_each (_O2, O2z(_oc4, _oc3)) {
+    int _O3 = _oc3 * this->O2 + _O2;
+    bool masked = this->Or != V
+        && _oc4 * this->oc3 * this->O2 + _O3 == this->oc2 - 1;
+    iter_each (_T, Tz) {
+      float *aout = &md2(aoutput, _T, _O3 * V);
+      float *atout = &md2(atoutput, _T, _O3 * V);
+      __m<V> mmout = masked
+          ? _mm512_maskz_loadu_ps(k, aout) + _mm512_maskz_loadu_ps(k, atout)
+          : _mm<V>::loadu_ps(aout) + _mm<V>::loadu_ps(atout);
+      if (last && this->with_relu)
+        mmout = this->template activate<V>(mmout);
+      if (masked)
+        _mm512_mask_storeu_ps(aout, k, mmout);
+      else
+        _mm512_storeu_ps(aout, mmout);
+    }
+  }}
+}
+
 } // namespace euler
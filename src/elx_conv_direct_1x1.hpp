@@ -5,6 +5,7 @@
 #include "el_def.hpp"
 #include "el_utils.hpp"
 #include "elx_conv.hpp"
+#include "el_parallel.hpp"
 #include "kernel/elk_gemm_otj_binder.hxx"
 
 namespace euler {
@@ -39,20 +40,20 @@ class elx_conv_direct_1x1_t : public elx_conv_t {
   void __execute_b061(OutputType *output, InputType *input, WeightsType *weights, BiasType *bias);
   void __execute_c060(OutputType *output, InputType *input, WeightsType *weights, BiasType *bias);
 
-  inline void __trans_input_nchw(TinputType *tinput, InputType *input, int _ht, int _wt);
-  inline void __trans_input_blocked(TinputType *tinput, InputType *input, int _ht, int _wt);
-  void trans_input(TinputType *tinput, InputType *input, int _ht, int _wt);
+  inline void __trans_input_nchw(TinputType *tinput, InputType *input, int _ht, int _wt, int Tz);
+  inline void __trans_input_blocked(TinputType *tinput, InputType *input, int _ht, int _wt, int Tz);
+  void trans_input(TinputType *tinput, InputType *input, int _ht, int _wt, int Tz);
 
-  inline void __trans_pad_input_plain(TinputType *tinput, InputType *input, int _ht, int _wt);
-  inline void __trans_pad_input_blocked(TinputType *tinput, InputType *input, int _ht, int _wt);
+  inline void __trans_pad_input_plain(TinputType *tinput, InputType *input, int _ht, int _wt, int Tz);
+  inline void __trans_pad_input_blocked(TinputType *tinput, InputType *input, int _ht, int _wt, int Tz);
 
   inline void __trans_input_plain2(TinputType *tinput, InputType *input, int _t2, int Tz);
   inline void __trans_input_blocked2(TinputType *tinput, InputType *input, int _t2, int Tz);
   void trans_input2(TinputType *tinput, InputType *input, int _t2, int Tz);
 
-  inline void __trans_output_nchw(OutputType *output, ToutputType *toutput, int _oc4, int _ht, int _wt);
-  inline void __trans_output_blocked(OutputType *output, ToutputType *toutput, int _oc4, int _ht, int _wt);
-  void trans_output(OutputType *output, ToutputType *toutput, int _oc4, int _ht, int _wt);
+  inline void __trans_output_nchw(OutputType *output, ToutputType *toutput, int _oc4, int _ht, int _wt, int Tz);
+  inline void __trans_output_blocked(OutputType *output, ToutputType *toutput, int _oc4, int _ht, int _wt, int Tz);
+  void trans_output(OutputType *output, ToutputType *toutput, int _oc4, int _ht, int _wt, int Tz);
 
   inline void __trans_output_plain2(OutputType *output, ToutputType *toutput, int _oc4, int _t2, int Tz);
   inline void __trans_output_blocked2(OutputType *output, ToutputType *toutput, int _oc4, int _t2, int Tz);
@@ -68,10 +69,11 @@ class elx_conv_direct_1x1_t : public elx_conv_t {
   inline void __trans_weights_Or_post(WeightsType *aweights, TweightsType *tweights,
       int _oc4, int _ic4, int _oc3, int _ic3, int _I2, int _iV, int _O2);
 
-  void gemm_a061(ToutputType *toutput, TinputType *tinput, TweightsType *tweights, BiasType *bias, int _ic4);
-  void gemm_f061(ToutputType *toutput, TinputType *tinput, TweightsType *tweights, BiasType *bias, int _t2, int Tz);
-  void gemm_b061(OutputType *output, TinputType *tinput, TweightsType *tweights, BiasType *bias, int _ic4);
-  void gemm_c060(OutputType *output, InputType *input, TweightsType *weights, BiasType *bias, int _ic4, int _oc4, int _t2);
+  void gemm_a061(ToutputType *toutput, TinputType *tinput, TweightsType *tweights, BiasType *bias, int _ic4, int _oc4, int Tz, bool partial = false);
+  void gemm_b061(OutputType *output, TinputType *tinput, TweightsType *tweights, BiasType *bias, int _ic4, int _oc4, int Tz);
+  void gemm_c060(OutputType *output, InputType *input, TweightsType *weights, BiasType *bias, int _ic4, int _oc4, int Tz);
+  void pad_output(OutputType *output, BiasType *bias, int _oc4, int _ht, int ows, int owe);
+  void add_partial(OutputType *output, ToutputType *toutput, int _oc4, int Tz, bool last);
 
   void trans_input_2_blocked(InputType *tinput, InputType *input);
   void trans_weights_2_blocked(WeightsType *tweghts, WeightsType *weights);
@@ -81,12 +83,44 @@ class elx_conv_direct_1x1_t : public elx_conv_t {
   int prepare_execute_opt();
   void bind_execute_functions();
 
+  // oc3 of oc4 block _oc4, O2 of (_oc4, _oc3): oc3r, O2r at the OC tail
+  inline int oc3z(int _oc4) {
+    return _oc4 == this->oc4 - 1 ? this->oc3r : this->oc3;
+  }
+  inline int O2z(int _oc4, int _oc3) {
+    return _oc4 == this->oc4 - 1 && _oc3 == this->oc3r - 1
+        ? this->O2r : this->O2;
+  }
+  // gemm kernel of (_oc4, _oc3) on a tile of Tz (T or Tr)
+  inline gemm_kernel_binder::kgemm<TarrayTypes> *ker_gemm(
+      int _oc4, int _oc3, int Tz) {
+    if (O2z(_oc4, _oc3) != this->O2)
+      return Tz == this->T ? ker_gemm_I_O2r_T_ : ker_gemm_I_O2r_Tr_;
+    return Tz == this->T ? ker_gemm_I_O_T_ : ker_gemm_I_O_Tr_;
+  }
+  // nhwc output: last oc block stores Or lanes only
+  inline int oc_attr(int attr, int _oc4, int _oc3) {
+    return this->output_fmt == nhwc && this->Or != V
+        && _oc4 == this->oc4 - 1 && _oc3 == this->oc3r - 1
+        ? set_attr(attr, has_Or_idx) : attr;
+  }
+
   gemm_kernel_binder::kgemm<TarrayTypes> *ker_gemm_I_O_T_;
   gemm_kernel_binder::kgemm<TarrayTypes> *ker_gemm_I_O_Tr_;
+  gemm_kernel_binder::kgemm<TarrayTypes> *ker_gemm_I_O2r_T_;
+  gemm_kernel_binder::kgemm<TarrayTypes> *ker_gemm_I_O2r_Tr_;
 
   void (elx_conv_direct_1x1_t::*execute_opt_)(OutputType *, InputType *, WeightsType *, BiasType *);
 
   bool no_pad_;
+  // input loaded in place; tiles of output rows, columns [ows_, owe_)
+  bool direct_input_;
+  bool row_tiles_;
+  int ows_, owe_;
+  // a061 nhwc: ic4 slices of a tile in parallel (K-split), partials added
+  // to output in turns
+  bool ksplit_;
+  ksplit_turns_t turns_;
   bool is_first_run_;
   bool inference_acc_;
 
@@ -100,6 +134,8 @@ class elx_conv_direct_1x1_t : public elx_conv_t {
   bool input_as_bfmt_;
   bool weights_as_bfmt_;
   bool output_as_bfmt_;
+  // plain output: ip-sum in output transform, activation after it
+  bool act_after_sum_;
 
   TweightsType *tweights_;
   TinputType *tinput_;
@@ -31,7 +31,10 @@ Instance_elx_conv_direct_1x1_t::bind_execute_functions()
       BIND_KERNEL(1, GKF_CCD)
       break;
     case (0xc060):
-      BIND_KERNEL(1, GKF_DCD)
+      if (this->ws == 1)
+        BIND_KERNEL(1, GKF_DCD)
+      else if (this->ws == 2)
+        BIND_KERNEL(2, GKF_DCD)
       break;
     default:
       el_error("Unknown xopt");
@@ -41,6 +44,8 @@ Instance_elx_conv_direct_1x1_t::bind_execute_functions()
 
   bind_kernel(this->O, this->T, &ker_gemm_I_O_T_);
   bind_kernel(this->O, this->Tr, &ker_gemm_I_O_Tr_);
+  bind_kernel(this->O2r, this->T, &ker_gemm_I_O2r_T_);
+  bind_kernel(this->O2r, this->Tr, &ker_gemm_I_O2r_Tr_);
 
 #define EXECUTE_CASE(n)                                                     \
   case 0x##n:                                                               \
@@ -6,20 +6,25 @@
 // kernel options:
 //   - a: CCC, s1
 //   - b: CCD, s1
-//   - c: DCD: s1
+//   - c: DCD: s1, s2
 // fusion:  same as winograd
 // dup:     same as winograd
 //
 // ------+-----+--------+-----+--------------------------------------
 //       | ker | fusion | dup |             notes
 // ------+-----+--------+-----+--------------------------------------
-//  a061 |  a  |   t+o  |  I  | plain, stride>=1, padding, Ir, oh=wt*T, ic4=1
+//  a061 |  a  |   t+o  |  I  | plain, stride>=1, padding, Ir, Tr,
+//       |     |        |     | nhwc: in-place input, stride-w<=2,
+//       |     |        |     | K-split of ic4 if tiles < threads
 // ------+-----+--------+-----+--------------------------------------
-//  f061 |  a  |   t+o  |  I  | plain, stride=1, Ir, Tr, ic4=1
+//  f061 |  a  |   t+o  |  I  | plain, stride=1, Ir, Tr
 // ------+-----+--------+-----+--------------------------------------
-//  b061 |  b  |   t+o  |  I  | blocked, stride>=1, oh=wt*T
+//  b061 |  b  |   t+o  |  I  | blocked, stride>=1, padding, Tr
 // ------+-----+--------+-----+--------------------------------------
-//  c060 |  c  |   t+o  |  -  | blocked, Tr, Or, stride=1
+//  c060 |  c  |   t+o  |  -  | blocked, Tr, Or, in-place input,
+//       |     |        |     | stride-w<=2, padding
+// ------+-----+--------+-----+--------------------------------------
+//  all: OC tails (O2r, oc3r), ic4 >= 1
 // ------+-----+--------+-----+--------------------------------------
 //
 
@@ -29,31 +34,75 @@ Template_elx_conv_direct_1x1_t
 void Instance_elx_conv_direct_1x1_t::__execute_c060(
     OutputType *output, InputType *input, WeightsType *weights, BiasType *bias)
 {
-  // weights: oc4*, oc3, O2, ic4*, ic3, I2, V, V
+  // weights: oc4*, oc3, O2(O2r), ic4*, ic3, I2, V, V
   // input:   t3*, ic4*, ic3, I2, t2*, T(Tr), V
-  // output:  t3*, oc4*, oc3, O2, t2*, T(Tr), V
+  // output:  t3*, oc4*, oc3, O2(O2r), t2*, T(Tr), V
+  // strided/padded (row tiles):
+  // input:   t3*, ic4*, ic3, I2, ih, iw, V, in place, strided by hs, ws
+  // output:  t3*, oc4*, oc3, O2(O2r), ht*, wt*, T(Tr), V
 
   if (is_first_run_) {
     trans_weights(tweights_, weights);
   }
 
-  parallel_for<4, 1>(mthr_, [&](int _t3, int _ic4, int _oc4, int _t2) {
-    MD3(InputType, ainput, input, this->t3, this->ic4,
-        this->ic3 * this->I2 * this->ih * this->iw * V);
-    MD2(OutputType, aoutput, output, this->t3, this->OC * this->oh * this->ow);
-    MD2(BiasType, abias, bias, this->oc4, this->oc3 * this->O2 * V);
-
-    MD3(TweightsType, atweights, tweights_, this->oc4, this->ic4,
-      this->oc3 * this->ic3 * this->O2 * this->I2 * V * V);
-    MD2(OutputType, aoutput2, &md2(aoutput, _t3, 0), this->oc4,
-        this->oc3 * this->O2 * this->oh * this->ow * V);
-    gemm_c060(
-        &md2(aoutput2, _oc4, 0),
-        &md3(ainput, _t3, _ic4, 0),
-        &md3(atweights, _oc4, _ic4, 0),
-        &md2(abias, _oc4, 0),
-        _ic4, _oc4, _t2);
-  }, this->t3, this->ic4, this->oc4, this->t2);
+  if (!row_tiles_) {
+    parallel_for<4, 1>(mthr_, [&](int _t3, int _ic4, int _oc4, int _t2) {
+      MD3(InputType, ainput, input, this->t3, this->ic4,
+          this->ic3 * this->I2 * this->ih * this->iw * V);
+      MD2(OutputType, aoutput, output, this->t3, this->OC * this->oh * this->ow);
+      MD2(BiasType, abias, bias, this->oc4, this->oc3 * this->O2 * V);
+
+      MD3(TweightsType, atweights, tweights_, this->oc4, this->ic4,
+        this->oc3 * this->ic3 * this->O2 * this->I2 * V * V);
+      MD3(OutputType, aoutput2, &md2(aoutput, _t3, 0), this->oc4,
+          this->oc3 * this->O2 * this->oh * this->ow, V);
+      MD2(InputType, ainput2, &md3(ainput, _t3, _ic4, 0),
+          this->ih * this->iw, V);
+      int Tz = _t2 == this->t2 - 1 ? this->Tr : this->T;
+      gemm_c060(
+          &md3(aoutput2, _oc4, _t2 * this->T, 0),
+          &md2(ainput2, _t2 * this->T, 0),
+          &md3(atweights, _oc4, _ic4, 0),
+          &md2(abias, _oc4, 0),
+          _ic4, _oc4, Tz);
+    }, this->t3, this->ic4, this->oc4, this->t2);
+  } else {
+    parallel_for<5, 1>(mthr_,
+        [&](int _t3, int _ic4, int _oc4, int _ht, int _wt) {
+      MD3(InputType, ainput, input, this->t3, this->ic4,
+          this->ic3 * this->I2 * this->ih * this->iw * V);
+      MD2(OutputType, aoutput, output, this->t3, this->OC * this->oh * this->ow);
+      MD2(BiasType, abias, bias, this->oc4, this->oc3 * this->O2 * V);
+
+      MD3(TweightsType, atweights, tweights_, this->oc4, this->ic4,
+        this->oc3 * this->ic3 * this->O2 * this->I2 * V * V);
+      MD4(OutputType, aoutput2, &md2(aoutput, _t3, 0), this->oc4,
+          this->oc3 * this->O2 * this->oh, this->ow, V);
+      MD3(InputType, ainput2, &md3(ainput, _t3, _ic4, 0),
+          this->ih, this->iw, V);
+
+      int Tz = _wt == this->wt - 1 ? this->Tr : this->T;
+      int _ow = ows_ + _wt * this->T;
+      int _ih = _ht * this->hs - this->tp;
+      bool pad_row = _ih < 0 || _ih >= this->ih;
+      if (_ic4 == 0) {
+        if (_wt == 0)
+          pad_output(&md2(aoutput, _t3, 0), bias, _oc4, _ht, 0, ows_);
+        if (_wt == this->wt - 1)
+          pad_output(&md2(aoutput, _t3, 0), bias, _oc4, _ht, owe_, this->ow);
+        if (pad_row)
+          pad_output(&md2(aoutput, _t3, 0), bias, _oc4, _ht, _ow, _ow + Tz);
+      }
+      if (pad_row)
+        return;
+      gemm_c060(
+          &md4(aoutput2, _oc4, _ht, _ow, 0),
+          &md3(ainput2, _ih, _ow * this->ws - this->lp, 0),
+          &md3(atweights, _oc4, _ic4, 0),
+          &md2(abias, _oc4, 0),
+          _ic4, _oc4, Tz);
+    }, this->t3, this->ic4, this->oc4, this->ht, this->wt);
+  }
 
   if (inference_acc_)
     is_first_run_ = false;
@@ -64,8 +113,8 @@ void Instance_elx_conv_direct_1x1_t::__execute_b061(
     OutputType *output, InputType *input, WeightsType *weights, BiasType *bias)
 {
   // weights: oc4*, oc3, O2(O2r), ic4*, ic3, I2, V, V
-  // input:   t3*, ic4*, ic3, I2, t2*, T(Tr), V
-  // output:  t3*, oc4*, oc3, O2(O2r), t2*, T(Tr), V
+  // input:   t3*, ic4*, ic3, I2, ht*, wt*, T(Tr), V
+  // output:  t3*, oc4*, oc3, O2(O2r), ht*, wt*, T(Tr), V
 
   if (is_first_run_) {
     trans_weights(tweights_, weights);
@@ -77,23 +126,24 @@ void Instance_elx_conv_direct_1x1_t::__execute_b061(
           this->ic3 * this->I2 * this->ih * this->iw * V);
       MD2(OutputType, aoutput, output, this->t3, this->OC * this->oh * this->ow);
       MD5(OutputType, aoutput2, &md2(aoutput, _t3, 0), this->oc4,
-          this->oc3 * this->O2, this->ht, this->wt, this->T * V);
+          this->oc3 * this->O2, this->oh, this->ow, V);
       MD2(BiasType, abias, bias, this->oc4, this->oc3 * this->O2 * V);
 
       MD2(TinputType, atinput, tinput_, mthr_, this->ic3 * this->I2 * this->T * V);
       MD3(TweightsType, atweights, tweights_, this->oc4, this->ic4,
           this->oc3 * this->ic3 * this->O2 * this->I2 * V * V);
       size_t ithr = omp_get_thread_num();
+      int Tz = _wt == this->wt - 1 ? this->Tr : this->T;
       trans_input(
           &md2(atinput, ithr, 0),
           &md3(ainput, _t3, _ic4, 0),
-          _ht, _wt);
+          _ht, _wt, Tz);
       gemm_b061(
-          &md5(aoutput2, _oc4, 0, _ht, _wt, 0),
+          &md5(aoutput2, _oc4, 0, _ht, _wt * this->T, 0),
           &md2(atinput, ithr, 0),
           &md3(atweights, _oc4, _ic4, 0),
           &md2(abias, _oc4, 0),
-          _ic4);
+          _ic4, _oc4, Tz);
     }, this->t3, this->ic4, this->oc4, this->ht, this->wt);
   } else {
 #pragma omp parallel num_threads(mthr_) proc_bind(close)
@@ -107,7 +157,7 @@ void Instance_elx_conv_direct_1x1_t::__execute_b061(
             this->ic3 * this->I2 * this->ih * this->iw * V);
         MD2(OutputType, aoutput, output, this->t3, this->OC * this->oh * this->ow);
         MD5(OutputType, aoutput2, &md2(aoutput, _t3, 0), this->oc4,
-            this->oc3 * this->O2, this->ht, this->wt, this->T * V);
+            this->oc3 * this->O2, this->oh, this->ow, V);
         MD2(BiasType, abias, bias, this->oc4, this->oc3 * this->O2 * V);
 
         MD4(TinputType, atinput, tinput_, mthr_, this->ht, this->wt,
@@ -117,6 +167,7 @@ void Instance_elx_conv_direct_1x1_t::__execute_b061(
         MD3(TweightsType, atweights, tweights_, this->oc4, this->ic4,
             this->oc3 * this->ic3 * this->O2 * this->I2 * V * V);
 
+        int Tz = _wt == this->wt - 1 ? this->Tr : this->T;
         if (_t3 != t3_history) {
           memset(&md4(atinput_msk, ithr, 0, 0, 0), 0, this->ic4 * this->ht * this->wt);
           t3_history = _t3;
@@ -125,15 +176,15 @@ void Instance_elx_conv_direct_1x1_t::__execute_b061(
           trans_input(
               &md4(atinput, ithr, _ht, _wt, 0),
               &md3(ainput, _t3, _ic4, 0),
-              _ht, _wt);
+              _ht, _wt, Tz);
           md4(atinput_msk, ithr, _ic4, _ht, _wt) = 1;
         }
         gemm_b061(
-            &md5(aoutput2, _oc4, 0, _ht, _wt, 0),
+            &md5(aoutput2, _oc4, 0, _ht, _wt * this->T, 0),
             &md4(atinput, ithr, _ht, _wt, 0),
             &md3(atweights, _oc4, _ic4, 0),
             &md2(abias, _oc4, 0),
-            _ic4);
+            _ic4, _oc4, Tz);
       }, this->t3, this->ic4, this->oc4, this->ht, this->wt);
     }
   }
@@ -146,38 +197,103 @@ Template_elx_conv_direct_1x1_t
 void Instance_elx_conv_direct_1x1_t::__execute_a061(
     OutputType *output, InputType *input, WeightsType *weights, BiasType *bias)
 {
+  // weights: oc4*, oc3, O2(O2r), ic4*, ic3, I2, V, V
+  // input:   t3*, ic4*, ic3, I2, V, ht*, wt*, T(Tr)
+  // output:  t3*, oc4*, oc3, O2(O2r), V, ht*, wt*, T(Tr)
+  // ic4 loop in task: partial sums of ic4 accumulated in T(Tr) tile
 
   if (is_first_run_) {
     trans_weights(tweights_, weights);
   }
 
-  if (this->input_fmt == nhwc) {
-    parallel_for<4>(mthr_, [&](int _t3, int _oc4, int _ht, int _wt) {
-      MD5(InputType, ainput0, input, this->t3, this->ht, this->hs,
-          this->iw, this->ic);
-      MD4(InputType, ainput1, &md5(ainput0, _t3, _ht, 0, 0, 0), this->wt,
-          this->T, this->ws, this->ic);
-      MD2(InputType, ainput2, &md4(ainput1, _wt, 0, 0, 0), this->ic4,
-          this->ic3 * this->I2 * V);
-      MD4(OutputType, aoutput0, output, this->t3, this->ht, this->ow, this->oc);
-      MD3(OutputType, aoutput1, &md4(aoutput0, _t3, _ht, 0, 0), this->wt,
-          this->T, this->oc);
-      MD2(OutputType, aoutput2, &md3(aoutput1, _wt, 0, 0), this->oc4,
-          this->oc3 * this->O2 * V);
+  if (this->input_fmt == nhwc && ksplit_) {
+    // K-split, ic4 slices of a tile in parallel: slice 0 in place, others
+    // to per-thread T x oc partial added in turns, activation by the last
+    turns_.begin_run();
+    parallel_for<5>(mthr_, [&](int _ic4, int _t3, int _oc4, int _ht, int _wt) {
+      MD4(InputType, ainput0, input, this->t3, this->ih, this->iw, this->ic);
+      MD4(OutputType, aoutput0, output, this->t3, this->oh, this->ow, this->oc);
       MD2(BiasType, abias, bias, this->oc4, this->oc3 * this->O2 * V);
       MD3(TweightsType, atweights, tweights_, this->oc4, this->ic4,
           this->oc3 * this->ic3 * this->O2 * this->I2 * V * V);
-
+      MD2(ToutputType, atoutput0, toutput_, mthr_, ALIGNUP(this->T * this->oc, V));
+
+      int Tz = _wt == this->wt - 1 ? this->Tr : this->T;
+      int _ow = ows_ + _wt * this->T;
+      int _ih = _ht * this->hs - this->tp;
+      auto aout = &md4(aoutput0, _t3, 0, 0, 0);
+      if (_ic4 == 0 && _wt == 0)
+        pad_output(aout, bias, _oc4, _ht, 0, ows_);
+      if (_ic4 == 0 && _wt == this->wt - 1)
+        pad_output(aout, bias, _oc4, _ht, owe_, this->ow);
+      if (_ih < 0 || _ih >= this->ih) {
+        if (_ic4 == 0)
+          pad_output(aout, bias, _oc4, _ht, _ow, _ow + Tz);
+        return;
+      }
+
+      MD2(InputType, ainput1, &md4(ainput0, _t3, _ih,
+          _ow * this->ws - this->lp, 0), this->ic4, this->ic3 * this->I2 * V);
+      MD2(OutputType, aoutput1, &md4(aoutput0, _t3, _ht, _ow, 0),
+          this->oc4, this->oc3 * this->O2 * V);
+      size_t ithr = omp_get_thread_num();
+      MD2(ToutputType, atoutput1, &md2(atoutput0, ithr, 0),
+          this->oc4, this->oc3 * this->O2 * V);
+      int _tile = ((_t3 * this->oc4 + _oc4) * this->ht + _ht) * this->wt + _wt;
+      bool partial = _ic4 > 0;
       gemm_a061(
-          &md2(aoutput2, _oc4, 0),
-          &md2(ainput2, 0, 0),
-          &md3(atweights, _oc4, 0, 0),
+          partial ? &md2(atoutput1, _oc4, 0) : &md2(aoutput1, _oc4, 0),
+          &md2(ainput1, _ic4, 0),
+          &md3(atweights, _oc4, _ic4, 0),
           &md2(abias, _oc4, 0),
-          0);
+          _ic4, _oc4, Tz, partial);
+      if (partial) {
+        turns_.wait(_tile, _ic4);
+        add_partial(&md2(aoutput1, _oc4, 0), &md2(atoutput1, _oc4, 0),
+            _oc4, Tz, _ic4 == this->ic4 - 1);
+      }
+      turns_.pass(_tile, _ic4);
+    }, this->ic4, this->t3, this->oc4, this->ht, this->wt);
+  } else if (this->input_fmt == nhwc) {
+    // input in place, strided by hs, ws; padding by pad_output
+    parallel_for<4>(mthr_, [&](int _t3, int _oc4, int _ht, int _wt) {
+      MD4(InputType, ainput0, input, this->t3, this->ih, this->iw, this->ic);
+      MD4(OutputType, aoutput0, output, this->t3, this->oh, this->ow, this->oc);
+      MD2(BiasType, abias, bias, this->oc4, this->oc3 * this->O2 * V);
+      MD3(TweightsType, atweights, tweights_, this->oc4, this->ic4,
+          this->oc3 * this->ic3 * this->O2 * this->I2 * V * V);
+
+      int Tz = _wt == this->wt - 1 ? this->Tr : this->T;
+      int _ow = ows_ + _wt * this->T;
+      int _ih = _ht * this->hs - this->tp;
+      auto aout = &md4(aoutput0, _t3, 0, 0, 0);
+      if (_wt == 0)
+        pad_output(aout, bias, _oc4, _ht, 0, ows_);
+      if (_wt == this->wt - 1)
+        pad_output(aout, bias, _oc4, _ht, owe_, this->ow);
+      if (_ih < 0 || _ih >= this->ih) {
+        pad_output(aout, bias, _oc4, _ht, _ow, _ow + Tz);
+        return;
+      }
+
+      MD2(InputType, ainput1, &md4(ainput0, _t3, _ih,
+          _ow * this->ws - this->lp, 0), this->ic4, this->ic3 * this->I2 * V);
+      MD2(OutputType, aoutput1, &md4(aoutput0, _t3, _ht, _ow, 0),
+          this->oc4, this->oc3 * this->O2 * V);
+      iter_each (_ic4, this->ic4) {
+        gemm_a061(
+            &md2(aoutput1, _oc4, 0),
+            &md2(ainput1, _ic4, 0),
+            &md3(atweights, _oc4, _ic4, 0),
+            &md2(abias, _oc4, 0),
+            _ic4, _oc4, Tz);
+      }
     }, this->t3, this->oc4, this->ht, this->wt);
   } else if (this->oc4 == 1) { // nchw
     parallel_for<4>(mthr_, [&](int _t3, int _oc4, int _ht, int _wt) {
       MD2(InputType, ainput, input, this->t3, this->ic * this->ih * this->iw);
+      MD2(InputType, ainput1, &md2(ainput, _t3, 0), this->ic4,
+          this->ic3 * this->I2 * V * this->ih * this->iw);
       MD2(OutputType, aoutput, output, this->t3, this->oc * this->oh * this->ow);
       MD2(BiasType, abias, bias, this->oc4, this->oc3 * this->O2 * V);
       MD2(TinputType, atinput, tinput_, mthr_, this->ic3 * this->I2 * this->T * V);
@@ -186,20 +302,23 @@ void Instance_elx_conv_direct_1x1_t::__execute_a061(
       MD2(ToutputType, atoutput, toutput_, mthr_, this->oc3 * this->O2 * this->T * V);
 
       size_t ithr = omp_get_thread_num();
+      int Tz = _wt == this->wt - 1 ? this->Tr : this->T;
+      iter_each (_ic4, this->ic4) {
         trans_input(
             &md2(atinput, ithr, 0),
-            &md2(ainput, _t3, 0),
-            _ht, _wt);
+            &md2(ainput1, _ic4, 0),
+            _ht, _wt, Tz);
         gemm_a061(
             &md2(atoutput, ithr, 0),
             &md2(atinput, ithr, 0),
-            &md3(atweights, _oc4, 0, 0),
+            &md3(atweights, _oc4, _ic4, 0),
             &md2(abias, _oc4, 0),
-            0);
-        trans_output(
-            &md2(aoutput, _t3, 0),
-            &md2(atoutput, ithr, 0),
-            _oc4, _ht, _wt);
+            _ic4, _oc4, Tz);
+      }
+      trans_output(
+          &md2(aoutput, _t3, 0),
+          &md2(atoutput, ithr, 0),
+          _oc4, _ht, _wt, Tz);
     }, this->t3, this->oc4, this->ht, this->wt);
   } else { // nchw
 #pragma omp parallel num_threads(mthr_) proc_bind(close)
@@ -208,36 +327,42 @@ void Instance_elx_conv_direct_1x1_t::__execute_a061(
       size_t ithr = omp_get_thread_num();
       thread_parallel_for<4>(mthr_, ithr, [&](int _t3, int _oc4, int _ht, int _wt) {
         MD2(InputType, ainput, input, this->t3, this->ic * this->ih * this->iw);
+        MD2(InputType, ainput1, &md2(ainput, _t3, 0), this->ic4,
+            this->ic3 * this->I2 * V * this->ih * this->iw);
         MD2(OutputType, aoutput, output, this->t3, this->oc * this->oh * this->ow);
         MD2(BiasType, abias, bias, this->oc4, this->oc3 * this->O2 * V);
-        MD4(TinputType, atinput, tinput_, mthr_, this->ht, this->wt,
+        MD5(TinputType, atinput, tinput_, mthr_, this->ic4, this->ht, this->wt,
             this->ic3 * this->I2 * this->T * V);
-        MD3(unsigned char, atinput_msk, tinput_msk_, mthr_, this->ht, this->wt);
+        MD4(unsigned char, atinput_msk, tinput_msk_, mthr_,
+            this->ic4, this->ht, this->wt);
         MD2(ToutputType, atoutput, toutput_, mthr_, this->oc3 * this->O2 * this->T * V);
         MD3(TweightsType, atweights, tweights_, this->oc4, this->ic4,
             this->oc3 * this->ic3 * this->O2 * this->I2 * V * V);
 
+        int Tz = _wt == this->wt - 1 ? this->Tr : this->T;
         if (_t3 != t3_history) {
-          memset(&md3(atinput_msk, ithr, 0, 0), 0, this->ht * this->wt);
+          memset(&md4(atinput_msk, ithr, 0, 0, 0), 0, this->ic4 * this->ht * this->wt);
           t3_history = _t3;
         }
-        if (md3(atinput_msk, ithr,  _ht, _wt) == 0) {
-          trans_input(
-              &md4(atinput, ithr, _ht, _wt, 0),
-              &md2(ainput, _t3, 0),
-              _ht, _wt);
-          md3(atinput_msk, ithr, _ht, _wt) = 1;
+        iter_each (_ic4, this->ic4) {
+          if (md4(atinput_msk, ithr, _ic4, _ht, _wt) == 0) {
+            trans_input(
+                &md5(atinput, ithr, _ic4, _ht, _wt, 0),
+                &md2(ainput1, _ic4, 0),
+                _ht, _wt, Tz);
+            md4(atinput_msk, ithr, _ic4, _ht, _wt) = 1;
+          }
+          gemm_a061(
+              &md2(atoutput, ithr, 0),
+              &md5(atinput, ithr, _ic4, _ht, _wt, 0),
+              &md3(atweights, _oc4, _ic4, 0),
+              &md2(abias, _oc4, 0),
+              _ic4, _oc4, Tz);
         }
-        gemm_a061(
-            &md2(atoutput, ithr, 0),
-            &md4(atinput, ithr, _ht, _wt, 0),
-            &md3(atweights, _oc4, 0, 0),
-            &md2(abias, _oc4, 0),
-            0);
         trans_output(
             &md2(aoutput, _t3, 0),
             &md2(atoutput, ithr, 0),
-            _oc4, _ht, _wt);
+            _oc4, _ht, _wt, Tz);
       }, this->t3, this->oc4, this->ht, this->wt);
     }
   }
@@ -250,6 +375,11 @@ Template_elx_conv_direct_1x1_t
 void Instance_elx_conv_direct_1x1_t::__execute_f061(
     OutputType *output, InputType *input, WeightsType *weights, BiasType *bias)
 {
+  // weights: oc4*, oc3, O2(O2r), ic4*, ic3, I2, V, V
+  // input:   t3*, ic4*, ic3, I2, V, t2*, T(Tr)
+  // output:  t3*, oc4*, oc3, O2(O2r), V, t2*, T(Tr)
+  // ic4 loop in task: partial sums of ic4 accumulated in T(Tr) tile
+
   if (is_first_run_) {
     trans_weights(tweights_, weights);
   }
@@ -267,16 +397,21 @@ void Instance_elx_conv_direct_1x1_t::__execute_f061(
       MD3(TweightsType, atweights, tweights_, this->oc4, this->ic4,
           this->oc3 * this->ic3 * this->O2 * this->I2 * V * V);
 
-      gemm_f061(
-          &md2(aoutput2, _oc4, 0),
-          &md2(ainput2, 0, 0),
-          &md3(atweights, _oc4, 0, 0),
-          &md2(abias, _oc4, 0),
-          _t2, 0);
+      int Tz = _t2 == (this->t2 - 1) ? this->Tr : this->T;
+      iter_each (_ic4, this->ic4) {
+        gemm_a061(
+            &md2(aoutput2, _oc4, 0),
+            &md2(ainput2, _ic4, 0),
+            &md3(atweights, _oc4, _ic4, 0),
+            &md2(abias, _oc4, 0),
+            _ic4, _oc4, Tz);
+      }
     }, this->t3, this->oc4, this->t2);
   } else if (this->oc4 == 1) { // nchw
     parallel_for<3>(mthr_, [&](int _t3, int _oc4, int _t2) {
       MD2(InputType, ainput, input, this->t3, this->ic * this->ih * this->iw);
+      MD2(InputType, ainput1, &md2(ainput, _t3, 0), this->ic4,
+          this->ic3 * this->I2 * V * this->ih * this->iw);
       MD2(OutputType, aoutput, output, this->t3, this->oc * this->oh * this->ow);
       MD2(BiasType, abias, bias, this->oc4, this->oc3 * this->O2 * V);
       MD2(TinputType, atinput, tinput_, mthr_, this->ic3 * this->I2 * this->T * V);
@@ -286,16 +421,18 @@ void Instance_elx_conv_direct_1x1_t::__execute_f061(
 
       size_t ithr = omp_get_thread_num();
       int Tz = _t2 == (this->t2 - 1) ? this->Tr : this->T;
-      trans_input2(
-           &md2(atinput, ithr, 0),
-           &md2(ainput, _t3, 0),
-           _t2, Tz);
-      gemm_f061(
-          &md2(atoutput, ithr, 0),
-          &md2(atinput, ithr, 0),
-          &md3(atweights, _oc4, 0, 0),
-          &md2(abias, _oc4, 0),
-          _t2, Tz);
+      iter_each (_ic4, this->ic4) {
+        trans_input2(
+            &md2(atinput, ithr, 0),
+            &md2(ainput1, _ic4, 0),
+            _t2, Tz);
+        gemm_a061(
+            &md2(atoutput, ithr, 0),
+            &md2(atinput, ithr, 0),
+            &md3(atweights, _oc4, _ic4, 0),
+            &md2(abias, _oc4, 0),
+            _ic4, _oc4, Tz);
+      }
       trans_output2(
           &md2(aoutput, _t3, 0),
           &md2(atoutput, ithr, 0),
@@ -308,33 +445,37 @@ void Instance_elx_conv_direct_1x1_t::__execute_f061(
       size_t ithr = omp_get_thread_num();
       thread_parallel_for<3>(mthr_, ithr, [&](int _t3, int _oc4, int _t2) {
         MD2(InputType, ainput, input, this->t3, this->ic * this->ih * this->iw);
+        MD2(InputType, ainput1, &md2(ainput, _t3, 0), this->ic4,
+            this->ic3 * this->I2 * V * this->ih * this->iw);
         MD2(OutputType, aoutput, output, this->t3, this->oc * this->oh * this->ow);
         MD2(BiasType, abias, bias, this->oc4, this->oc3 * this->O2 * V);
-        MD3(TinputType, atinput, tinput_, mthr_, this->t2,
+        MD4(TinputType, atinput, tinput_, mthr_, this->ic4, this->t2,
             this->ic3 * this->I2 * this->T * V);
-        MD2(unsigned char, atinput_msk, tinput_msk_, mthr_, this->t2);
+        MD3(unsigned char, atinput_msk, tinput_msk_, mthr_, this->ic4, this->t2);
         MD3(TweightsType, atweights, tweights_, this->oc4, this->ic4,
             this->oc3 * this->ic3 * this->O2 * this->I2 * V * V);
         MD2(ToutputType, atoutput, toutput_, mthr_, this->oc3 * this->O2 * this->T * V);
 
         int Tz = _t2 == (this->t2 - 1) ? this->Tr : this->T;
         if (_t3 != t3_history) {
-          memset(&md2(atinput_msk, ithr, 0), 0, this->t2);
+          memset(&md3(atinput_msk, ithr, 0, 0), 0, this->ic4 * this->t2);
           t3_history = _t3;
         }
-        if (md2(atinput_msk, ithr, _t2) == 0) {
-          trans_input2(
-              &md3(atinput, ithr, _t2, 0),
-              &md2(ainput, _t3, 0),
-              _t2, Tz);
-          md2(atinput_msk, ithr, _t2) = 1;
+        iter_each (_ic4, this->ic4) {
+          if (md3(atinput_msk, ithr, _ic4, _t2) == 0) {
+            trans_input2(
+                &md4(atinput, ithr, _ic4, _t2, 0),
+                &md2(ainput1, _ic4, 0),
+                _t2, Tz);
+            md3(atinput_msk, ithr, _ic4, _t2) = 1;
+          }
+          gemm_a061(
+              &md2(atoutput, ithr, 0),
+              &md4(atinput, ithr, _ic4, _t2, 0),
+              &md3(atweights, _oc4, _ic4, 0),
+              &md2(abias, _oc4, 0),
+              _ic4, _oc4, Tz);
         }
-        gemm_f061(
-            &md2(atoutput, ithr, 0),
-            &md3(atinput, ithr, _t2, 0),
-            &md3(atweights, _oc4, 0, 0),
-            &md2(abias, _oc4, 0),
-            _t2, Tz);
         trans_output2(
             &md2(aoutput, _t3, 0),
             &md2(atoutput, ithr, 0),
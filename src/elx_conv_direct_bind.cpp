@@ -80,9 +80,29 @@ Instance_elx_conv_direct_t::bind_execute_functions()
     }
   };
 
+  auto bind_conv_2d_kernel = [&](int H, int T,
+      conv_2d_kernel_binder::kconv<TarrayTypes> **func) {
+    if (this->input_fmt == nhwc) {
+      if (this->ws == 1)
+        conv_2d_kernel_binder::bind<1, GKF_FCF>(this->O, H, T, func);
+      else
+        conv_2d_kernel_binder::bind<2, GKF_FCF>(this->O, H, T, func);
+    } else { // blocked
+      if (this->ws == 1)
+        conv_2d_kernel_binder::bind<1, GKF_DCD>(this->O, H, T, func);
+      else
+        conv_2d_kernel_binder::bind<2, GKF_DCD>(this->O, H, T, func);
+    }
+  };
+
   if (xopt_ == 0xa060 || xopt_ == 0xb060) {
     bind_conv_kernel(this->O, this->T, &ker_conv_, this->kw);
     bind_conv_kernel(this->O, this->Tr, &ker_conv_Tr_, this->kw);
+  } else if (xopt_ == 0xa061) {
+    bind_conv_2d_kernel(this->H, this->T, &ker_conv_2d_[0][0]);
+    bind_conv_2d_kernel(this->H, this->Tr, &ker_conv_2d_[0][1]);
+    bind_conv_2d_kernel(this->Hr, this->T, &ker_conv_2d_[1][0]);
+    bind_conv_2d_kernel(this->Hr, this->Tr, &ker_conv_2d_[1][1]);
   } else if (xopt_ == 0xd060) {
     if (this->wt > 128) {
       el_error("direct: d160: wt > max-kernel-slot:128");
@@ -102,7 +122,10 @@ Instance_elx_conv_direct_t::bind_execute_functions()
           _iwe -= this->ws;
         auto _ows = (_iws + this->lp - _kw) / this->ws;
         auto _owe = (_iwe + this->lp - _kw) / this->ws;
-        bind_gemm_kernel(this->O, _owe - _ows + 1, &ker_gemm_[_wt][_kw]);
+        if (_iws > _iwe || _owe < _ows)
+          ker_gemm_[_wt][_kw] = nullptr;
+        else
+          bind_gemm_kernel(this->O, _owe - _ows + 1, &ker_gemm_[_wt][_kw]);
       }
     }
   }
@@ -115,6 +138,7 @@ Instance_elx_conv_direct_t::bind_execute_functions()
 
   switch (xopt_) {
     EXECUTE_CASE(a060);
+    EXECUTE_CASE(a061);
     EXECUTE_CASE(b060);
     EXECUTE_CASE(d060);
   default:
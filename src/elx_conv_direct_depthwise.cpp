@@ -0,0 +1,182 @@
+#include "el_intrin.hpp"
+#include "el_stl.hpp"
+#include "el_utils.hpp"
+#include "el_parallel.hpp"
+#include "elx_conv_direct_depthwise.hpp"
+
+namespace euler {
+
+// depth-wise, fp32
+Template_elx_conv_direct_depthwise_t
+Instance_elx_conv_direct_depthwise_t::elx_conv_direct_depthwise_t(eld_conv_t &dc)
+    : elx_conv_t(dc)
+{
+  // user input
+  xopt_ = this->execution_mode;
+  mthr_ = omp_get_max_threads();
+
+  this->grp = this->g;
+  this->vmg = 1;
+  this->Vx = 1;
+  this->V1 = V / this->Vx;
+  this->ocg = this->oc / this->g;
+  this->icg = this->ic / this->g;
+
+  // kw = 3..7, ws = 1|2, any kh, hs, padding and dilation
+  bool shape_ok = this->icg == 1 && this->ocg == 1 &&
+                  this->kw >= 3 && this->kw <= 7 &&
+                  estl::any_of(this->ws, 1, 2);
+  if (!shape_ok) {
+    el_error("direct_depthwise: shape not supported");
+  }
+  bool format_ok =
+      estl::any_of(this->weights_fmt, ghwio, goihw, gOIhw16i16o) &&
+      estl::any_of(this->input_fmt, nhwc, nChw16c) &&
+      this->output_fmt == this->input_fmt;
+  if (!format_ok) {
+    el_error("direct_depthwise: format not supported");
+  }
+
+  // ic = oc = g, in V blocks
+  this->g2 = ALIGNUP(this->g, V) / V;
+  this->IC = this->g2 * V;
+  this->OC = this->g2 * V;
+  this->ic2 = this->g2;
+  this->oc2 = this->g2;
+  this->Ir = 0;
+  this->Or = this->g % V ? this->g % V : V;
+  this->ormask = (1 << this->Or) - 1;
+
+  if (this->T == 0) this->T = estl::min(this->ow, 14);
+  if (this->T > 16) {
+    el_error("direct_depthwise: T > 16 not supported");
+  }
+
+  xopt_ = 0xa060;
+
+  // t3, t2, (T, Tr)
+  this->t3 = this->n;
+  this->ht = this->oh;
+  this->wt = (this->ow + this->T - 1) / this->T;
+  this->Tr = this->ow % this->T ? this->ow % this->T : this->T;
+  this->nt = this->oh * this->ow;
+  this->t2 = this->nt / this->T;
+  this->t  = this->nt * this->n;
+
+  attr_ = 0x0;
+  is_first_run_ = true;
+  inference_acc_ = this->prop_kind == forward_inference;
+
+  attr_ = this->with_bias ? set_attr(attr_, bias_idx) : attr_;
+  attr_ = this->with_ip_sum ? set_attr(attr_, ip_sum_idx) : attr_;
+  attr_ = this->with_relu ? set_attr(attr_, relu_idx) : attr_;
+
+  prepare_execute_opt();
+  bind_execute_functions();
+
+  // dbg
+  printf("T=%d, Tr=%d, t2=%d, ht=%d, wt=%d, t=%d\n",
+      this->T, this->Tr, this->t2, this->ht, this->wt, this->t);
+  printf("V=%d, Or=%d, g2=%d, g=%d\n", V, this->Or, this->g2, this->g);
+}
+
+Template_elx_conv_direct_depthwise_t
+int Instance_elx_conv_direct_depthwise_t::prepare_execute_opt()
+{
+  tweights_size_ = 0;
+  tweights_ = nullptr;
+  workspace_ = nullptr;
+
+  switch (xopt_) {
+  case 0xa060:
+    tweights_size_ = this->g2 * this->kh * this->kw * V * sizeof(TweightsType);
+    break;
+  default:
+    el_error("Unknown xopt!");
+    return -1;
+    break;
+  }
+
+  size_t workspace_size = tweights_size_;
+  // TODO: user provided buffer
+  if (workspace_size != 0) {
+    MEMALIGN64(&workspace_, workspace_size);
+    tweights_ = (TweightsType *)workspace_;
+  }
+
+  return 0;
+}
+
+Template_elx_conv_direct_depthwise_t
+void Instance_elx_conv_direct_depthwise_t::set_trans_buffers()
+{
+}
+
+Template_elx_conv_direct_depthwise_t
+Instance_elx_conv_direct_depthwise_t::~elx_conv_direct_depthwise_t()
+{
+  if (workspace_ != nullptr)
+    ::free(workspace_);
+}
+
+// weights: g, kh, kw (ghwio|goihw) | g, kh, kw, 16i, 16o (gOIhw16i16o)
+// tweights: g2, kh, kw, V
+Template_elx_conv_direct_depthwise_t
+void Instance_elx_conv_direct_depthwise_t::trans_weights(
+    TweightsType *tweights, WeightsType *weights)
+{
+  parallel_for<3>(mthr_, [&](int _g2, int _kh, int _kw) {
+    MD3(WeightsType, aweights, weights, this->g, this->kh, this->kw);
+    MD5(WeightsType, aweights_blocked, weights, this->g, this->kh, this->kw, V, V);
+    MD4(TweightsType, atweights, tweights, this->g2, this->kh, this->kw, V);
+
+    alignas(64) float w[V];
+    iter_each (_V, V) {
+      int _g = _g2 * V + _V;
+      if (_g >= this->g)
+        w[_V] = 0.0f;
+      else if (this->weights_fmt == gOIhw16i16o)
+        w[_V] = md5(aweights_blocked, _g, _kh, _kw, 0, 0);
+      else
+        w[_V] = md3(aweights, _g, _kh, _kw);
+    }
+
+    if (std::is_same<TweightsType, float>::value) {
+      _mm<V>::store_ps(&md4(atweights, _g2, _kh, _kw, 0), *(__m<V> *)w);
+    } else {
+      auto fp16v = _mm<V>::cvtps_ph(
+          *(__m<V> *)w, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+      _mm<V / 2>::store_si256(
+          (__m256i *)&md4(atweights, _g2, _kh, _kw, 0), fp16v);
+    }
+  }, this->g2, this->kh, this->kw);
+}
+
+// output: tile of block _g2, input: (0, 0) of block _g2
+Template_elx_conv_direct_depthwise_t
+void Instance_elx_conv_direct_depthwise_t::conv_a060(OutputType *output,
+    InputType *input, TweightsType *weights, BiasType *bias, int _g2,
+    int _ht, int _wt)
+{
+  MD2(TweightsType, atweights, weights, this->g2, this->kh * this->kw * V);
+  MD2(BiasType, abias, bias, this->g2, V);
+
+  auto ker_conv = _wt == this->wt - 1 ? ker_conv_Tr_ : ker_conv_;
+  int T = _wt == this->wt - 1 ? this->Tr : this->T;
+
+  int _ih = _ht * this->hs - this->tp;
+  int _iw = _wt * this->T * this->ws - this->lp;
+  int khs = _ih < 0 ? (this->hd - 1 - _ih) / this->hd : 0;
+  int khe = estl::min(this->kh, (this->ih - _ih + this->hd - 1) / this->hd);
+  bool border = _iw < 0 ||
+      _iw + (T - 1) * this->ws + (this->kw - 1) * this->wd >= this->iw;
+
+  int attr = attr_;
+  if (this->input_fmt == nhwc && this->Or != V && _g2 == this->g2 - 1)
+    attr = set_attr(attr, has_Or_idx);
+
+  ker_conv(*this, output, input, &md2(atweights, _g2, 0), &md2(abias, _g2, 0),
+      _ih, _iw, khs, khe, border, attr);
+}
+
+} // namespace euler
@@ -0,0 +1,47 @@
+#include "elx_conv_direct_depthwise.hpp"
+
+namespace euler {
+
+Template_elx_conv_direct_depthwise_t void
+Instance_elx_conv_direct_depthwise_t::bind_execute_functions()
+{
+  auto bind_conv_kernel = [&](int T,
+      depthwise_conv_kernel_binder::kconv<TarrayTypes> **func) {
+    switch (xopt_) {
+    case (0xa060):
+      if (this->input_fmt == nhwc) {
+        if (this->ws == 1)
+          depthwise_conv_kernel_binder::bind<1, GKF_FCF>(T, this->kw, func);
+        else
+          depthwise_conv_kernel_binder::bind<2, GKF_FCF>(T, this->kw, func);
+      } else {
+        if (this->ws == 1)
+          depthwise_conv_kernel_binder::bind<1, GKF_DCD>(T, this->kw, func);
+        else
+          depthwise_conv_kernel_binder::bind<2, GKF_DCD>(T, this->kw, func);
+      }
+      break;
+    default:
+      el_error("Unknown xopt");
+      break;
+    }
+  };
+
+  bind_conv_kernel(this->T, &ker_conv_);
+  bind_conv_kernel(this->Tr, &ker_conv_Tr_);
+
+#define EXECUTE_CASE(n)                                                        \
+  case 0x##n:                                                                  \
+    printf("execute_opt=" #n "\n");                                            \
+    execute_opt_ = &Instance_elx_conv_direct_depthwise_t::__execute_##n;       \
+    break
+
+  switch (xopt_) {
+    EXECUTE_CASE(a060);
+  default:
+    el_error("direct_depthwise: Unimplemented xopt");
+    break;
+  }
+}
+
+} // namespace euler
@@ -261,14 +261,14 @@ Instance_elx_conv_direct_depthwise_lp_t::trans_weights_3x3(
   }, this->g2, V);
 
   // combine with output restore
-  auto out_repS = _mm<V>::set1_ps(this->output_quant_repS);
-  auto out_z = _mm<V>::set1_ps(this->output_quant_z);
   auto input_S = _mm<V>::set1_ps(this->input_quant_S);
   auto input_z = _mm<V>::set1_ps(this->input_quant_z);
 
   parallel_for<1>(mthr_, [&](int _g2) {
     MD2(TscaleType, aweights_scale, weights_scale, this->g2, V);
     __m<V> &qs = *(__m<V> *)&md2(aweights_scale, _g2, 0);
+    __m<V> out_repS, out_z;
+    this->template load_output_quant<V>(_g2, out_repS, out_z);
     if (std::is_same<OutputType, float>::value) {
       qs = input_S * qs;
     } else {
@@ -284,6 +284,8 @@ Instance_elx_conv_direct_depthwise_lp_t::trans_weights_3x3(
     __m<V> qs = *(__m<V> *)&md2(aweights_scale, _g2, 0);
     __m<V> b = this->with_bias ? *(__m<V> *)&md2(abias, _g2, 0) : _mm<V>::setzero_ps();
     __m<V> &qf = *(__m<V> *)&md2(aweights_factor, _g2, 0);
+    __m<V> out_repS, out_z;
+    this->template load_output_quant<V>(_g2, out_repS, out_z);
 
     if (std::is_same<OutputType, float>::value) {
       qf = b - input_z * qf * qs;
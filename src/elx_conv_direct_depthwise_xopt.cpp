@@ -0,0 +1,65 @@
+#include "elx_conv_direct_depthwise.hpp"
+#include "el_parallel.hpp"
+
+// XOPT
+//
+// fusion:  same as winograd
+// dup:     same as winograd
+// ------+-----+--------+-----+------------------------------------------------
+//       | ker | fusion | dup |             notes
+// ------+-----+--------+-----+------------------------------------------------
+//  a060 |conv |   t+o  |  -  | blocked/nhwc, Tr, K=3..7 S=1,2, any pad/dilation
+// ------+-----+--------+-----+------------------------------------------------
+//
+namespace euler {
+
+Template_elx_conv_direct_depthwise_t
+void Instance_elx_conv_direct_depthwise_t::__execute_a060(
+    OutputType *output, InputType *input, WeightsType *weights, BiasType *bias)
+{
+  // input (blocked): t3*, g2*, ih, iw, V
+  // input (nhwc): t3*, ih, iw, g2*, V
+  // output (blocked): t3*, g2*, ht*, wt, T, V
+  // output (nhwc): t3*, ht*, wt, T, g2*, V
+  if (is_first_run_) {
+    trans_weights(tweights_, weights);
+  }
+
+  if (this->input_fmt == nhwc) {
+    parallel_for<3>(mthr_, [&](int _t3, int _g2, int _ht) {
+      MD2(InputType, ainput0, input, this->t3, this->ih * this->iw * this->ic);
+      MD2(InputType, ainput1, &md2(ainput0, _t3, 0), this->g2, V);
+      MD4(OutputType, aoutput, output, this->t3, this->ht, this->ow, this->oc);
+      iter_each (_wt, this->wt) {
+        conv_a060(&md4(aoutput, _t3, _ht, _wt * this->T, _g2 * V),
+            &md2(ainput1, _g2, 0), tweights_, bias, _g2, _ht, _wt);
+      }
+    }, this->t3, this->g2, this->ht);
+  } else {
+    parallel_for<3>(mthr_, [&](int _t3, int _g2, int _ht) {
+      MD3(InputType, ainput, input, this->t3, this->g2,
+          this->ih * this->iw * V);
+      MD5(OutputType, aoutput, output, this->t3, this->g2, this->ht,
+          this->ow, V);
+      iter_each (_wt, this->wt) {
+        conv_a060(&md5(aoutput, _t3, _g2, _ht, _wt * this->T, 0),
+            &md3(ainput, _t3, _g2, 0), tweights_, bias, _g2, _ht, _wt);
+      }
+    }, this->t3, this->g2, this->ht);
+  }
+
+  if (inference_acc_)
+    is_first_run_ = false;
+}
+
+Template_elx_conv_direct_depthwise_t
+void Instance_elx_conv_direct_depthwise_t::execute(
+    void *output, void *input, void *weights, void *bias)
+{
+  set_trans_buffers();
+
+  (this->*execute_opt_)((OutputType *)output,
+      (InputType *)input, (WeightsType *)weights, (BiasType *)bias);
+}
+
+} // namespace euler
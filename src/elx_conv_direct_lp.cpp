@@ -371,8 +371,6 @@ Instance_elx_conv_direct_lp_t::__trans_weights_acc(TscaleType *weights_scale,
     md7(atweights_factor_buf, _wacc_h, _wacc_w, _oc4, _oc3, _O1, _O, _oV) = acc;
   }, wacc_h_, wacc_w_, this->oc4, this->oc3, this->O1, this->O, V);
 
-  auto out_repS = _mm<V>::set1_ps(this->output_quant_repS);
-  auto out_z = _mm<V>::set1_ps(this->output_quant_z);
   auto input_S = _mm<V>::set1_ps(this->input_quant_S);
   auto input_z = _mm<V>::set1_ps(this->input_quant_z);
 
@@ -381,6 +379,8 @@ Instance_elx_conv_direct_lp_t::__trans_weights_acc(TscaleType *weights_scale,
     MD2(TscaleType, atweights_scale, weights_scale, this->oc2, V);
     MD2(BiasType, abias, bias, this->oc2, V);
     __m<V> &qs = *(__m<V> *)&md2(atweights_scale, _oc2, 0);
+    __m<V> out_repS, out_z;
+    this->template load_output_quant<V>(_oc2, out_repS, out_z);
 
     if (std::is_same<OutputType, float>::value) {
       qs = input_S * qs;
@@ -397,6 +397,8 @@ Instance_elx_conv_direct_lp_t::__trans_weights_acc(TscaleType *weights_scale,
 
     __m<V> qs = *(__m<V> *)&md2(atweights_scale, _oc2, 0);
     __m<V> b = this->with_bias ? *(__m<V> *)&md2(abias, _oc2, 0) : _mm<V>::setzero_ps();
+    __m<V> out_repS, out_z;
+    this->template load_output_quant<V>(_oc2, out_repS, out_z);
 
     iter_each(_wacc_h, wacc_h_) {
       iter_each(_wt, wacc_wt_) {
@@ -697,8 +699,6 @@ void Instance_elx_conv_direct_lp_t::gemm_d160(OutputType *output,
     }
 
     if (_ic4 == this->ic4 - 1 && _ic3 == this->ic3 - 1) {
-      __m<V> out_repS = _mm<V>::set1_ps(this->output_quant_repS);
-      __m<V> out_z = _mm<V>::set1_ps(this->output_quant_z);
       iter_each (_O2, this->O2) {
       iter_each (_T, Tz) {
         MD4(ToutputType, atoutput1_nhwc, &md3(atoutput0_nhwc, _ht, ows0 + _T, 0),
@@ -718,9 +718,11 @@ void Instance_elx_conv_direct_lp_t::gemm_d160(OutputType *output,
           auto scale = *(__m<V> *)&md3(aweights_scale, _oc3, _O2, 0);
           auto factor = *(__m<V> *)&md3(aweights_factor, _oc3, _O2, 0);
           tout = tout * scale + factor;
-          // fuse relu
+          // fuse activation
           if (this->with_relu)
-            tout = _mm<V>::max_ps(tout, _mm<V>::setzero_ps());
+            tout = this->template activate<V,
+                std::is_same<OutputType, int8_t>::value
+                || std::is_same<OutputType, uint8_t>::value>(tout);
 
           if (std::is_same<OutputType, int8_t>::value ||
               std::is_same<OutputType, uint8_t>::value) {
@@ -22,21 +22,26 @@ Instance_elx_conv_direct_vmg_t::elx_conv_direct_vmg_t(eld_conv_t &dc)
   this->ocg = this->oc / this->g;
   this->icg = this->ic / this->g;
 
-  // oc = ic = 16x && ocg = icg = 1|2|4|8|16 (V=16)
+  // oc = 16x && ocg, icg = 1|2|4|8|16 (V=16) && icg <= ocg
+  // same padding, ih = oh * hs, iw = ow * ws, ws = 1|2
   bool shape_ok = this->ic % this->g == 0 && this->oc % this->g == 0 &&
                   (this->ocg <= V) && (V % this->ocg == 0) &&
-                  (this->oc % V == 0) && (this->ic == this->oc) &&
+                  (V % this->icg == 0) && (this->icg <= this->ocg) &&
+                  (this->oc % V == 0) &&
                   estl::any_of(this->kh, 3, 5, 7) &&
-                  estl::any_of(this->kw, 3, 5, 7) && (this->ws == 1) &&
-                  this->lp == (this->kw / 2) && (this->tp == this->kh / 2);
+                  estl::any_of(this->kw, 3, 5, 7) &&
+                  estl::any_of(this->ws, 1, 2) &&
+                  this->lp == (this->kw / 2) && (this->tp == this->kh / 2) &&
+                  this->ih == this->oh * this->hs &&
+                  this->iw == this->ow * this->ws;
   if (!shape_ok) {
     el_error("direct_vmg: shape not supported");
   }
 
   // compute multiple groups in one FMA
   // vector multi-group number
-  // C = ocg|icg; G = vmg, V = C * G
-  // grp = g * G
+  // C = ocg; G = vmg, V = C * G
+  // grp = g * G, G * icg input channels per step
   this->vmg = V / this->ocg;
   this->g /= this->vmg;
   if (this->O != 1) {
@@ -49,10 +54,26 @@ Instance_elx_conv_direct_vmg_t::elx_conv_direct_vmg_t(eld_conv_t &dc)
   this->G = this->vmg;
   this->C = this->ocg;
 
+  // Lane _V of an output vector is of group _V / C, input channel _i of
+  // the group is lane _V / C * icg + _i of the G * icg input channels
+  if (this->icg != C) {
+    this->vmg_perm.resize(this->icg * V);
+    iter_each (_i, this->icg) {
+      iter_each (_V, V)
+        this->vmg_perm[_i * V + _V] = _V / C * this->icg + _i;
+    }
+  }
+
   this->IC = ALIGNUP(this->ic, V);
   this->OC = ALIGNUP(this->oc, V);
 
-  if (this->T == 0) this->T = 1;
+  if (this->T == 0) {
+    // largest tile with the right halo in the last tile
+    this->T = estl::min(this->ow, 14);
+    while (this->T > 1 && this->ow % this->T != 0 &&
+           this->ow % this->T <= this->rp)
+      this->T--;
+  }
   this->I2 = 1;
 
   this->oc4 = 1;
@@ -83,8 +104,8 @@ Instance_elx_conv_direct_vmg_t::elx_conv_direct_vmg_t(eld_conv_t &dc)
     el_error("Unimplemented T: (T,Tr) must greater than (lp,rp)");
   }
   bool format_ok = estl::any_of(this->weights_fmt, ghwio) &&
-                   estl::any_of(this->input_fmt, nchw, nChw16c) &&
-                   estl::any_of(this->output_fmt, nchw, nChw16c);
+                   estl::any_of(this->input_fmt, nhwc, nChw16c) &&
+                   this->output_fmt == this->input_fmt;
   if (!format_ok) {
     el_error("direct: format not supported");
   }
@@ -140,7 +161,7 @@ int Instance_elx_conv_direct_vmg_t::prepare_execute_opt()
 
   switch (xopt_) {
   case 0xa060:
-    tweights_size_ = this->g * G * this->kh * this->kw * C * C * sizeof(TweightsType);
+    tweights_size_ = this->g * G * this->kh * this->kw * this->icg * C * sizeof(TweightsType);
     break;
   default:
     el_error("Unknown xopt!");
@@ -180,16 +201,16 @@ Instance_elx_conv_direct_vmg_t::~elx_conv_direct_vmg_t()
   galloc::release();
 }
 
-// weights: g, G, kh, kw, C(i), C(o)
-// tweights: g, kh, kw, C(i), G, C(o)
+// weights: g, G, kh, kw, icg, C(o)
+// tweights: g, kh, kw, icg, G, C(o)
 Template_elx_conv_direct_vmg_t
 void Instance_elx_conv_direct_vmg_t::trans_weights_to_compact(
     TweightsType *tweights, WeightsType *weights)
 {
   if (this->weights_fmt == hwio || this->weights_fmt == ghwio) {
     parallel_for<4>(mthr_, [&](int _g, int _kh, int _kw, int _iV) {
-      MD6(WeightsType, aweights, weights, this->g, G, this->kh, this->kw, C, C);
-      MD5(TweightsType, atweights, tweights, this->g, this->kh, this->kw, C, V);
+      MD6(WeightsType, aweights, weights, this->g, G, this->kh, this->kw, this->icg, C);
+      MD5(TweightsType, atweights, tweights, this->g, this->kh, this->kw, this->icg, V);
       WeightsType w[V];
       iter_each (_G, G) {
         iter_each (_oV, C) {
@@ -207,14 +228,14 @@ void Instance_elx_conv_direct_vmg_t::trans_weights_to_compact(
               (__m256i *)&md5(atweights, _g, _kh, _kw, _iV, 0), fp16v);
         }
       }
-    }, this->g, this->kh, this->kw, C);
+    }, this->g, this->kh, this->kw, this->icg);
   } else {
     el_error("Unimplemented weights format\n");
   }
   // clang-format on
 }
 
-// kh,kw=odd, lp=rp=standard, ih=oh*hs, iw=ow*ws, hs=ws=1
+// kh,kw=odd, lp=rp=standard, ih=oh*hs, iw=ow*ws, ws=1,2
 Template_elx_conv_direct_vmg_t void
 Instance_elx_conv_direct_vmg_t::conv_a060(OutputType *output,
     InputType *input, TweightsType *weights, BiasType *bias, int _ic4, int _oc4,
@@ -223,7 +244,7 @@ Instance_elx_conv_direct_vmg_t::conv_a060(OutputType *output,
   // input:   ic3*, I2, V, ht*, hs*, wt*, T, ws
   // output:  oc3*, O2, ht*, wt*, T, V
   MD3(TweightsType, aweights, weights, this->oc3, this->ic3,
-      this->kh * this->kw * this->O2 * this->I2 * V * C);
+      this->kh * this->kw * this->O2 * this->I2 * V * this->icg);
   MD2(BiasType, abias, bias, this->oc3, this->O2 * V);
 
   auto ker_conv = _wt == this->wt - 1 ? ker_conv_Tr_ : ker_conv_;
@@ -30,14 +30,18 @@ Instance_elx_conv_direct_vmg_t::bind_execute_functions() {
       if (this->input_fmt == nhwc) {
         if (this->ws == 1) {
           BIND_CONV_KERNEL(1, GKF_FCF, K, G);
+        } else if (this->ws == 2) {
+          BIND_CONV_KERNEL(2, GKF_FCF, K, G);
         } else {
-          el_error("Stride > 1 not yet bounded");
+          el_error("Stride > 2 not yet bounded");
         }
       } else {
         if (this->ws == 1) {
           BIND_CONV_KERNEL(1, GKF_DCD, K, G);
+        } else if (this->ws == 2) {
+          BIND_CONV_KERNEL(2, GKF_DCD, K, G);
         } else {
-          el_error("Stride > 1 not yet bounded");
+          el_error("Stride > 2 not yet bounded");
         }
       }
       break;
@@ -8,7 +8,7 @@
 // ------+-----+--------+-----+------------------------------------------------
 //       | ker | fusion | dup |             notes
 // ------+-----+--------+-----+------------------------------------------------
-//  a060 |conv |   t+o  |  -  | nhwc|blocked, Tr, K=3,5,7 S=1 G=1,2,4,8,16
+//  a060 |conv |   t+o  |  -  | nhwc|blocked, Tr, K=3 S=1,2 G=1,2,4,8,16
 // ------+-----+--------+-----+------------------------------------------------
 //
 namespace euler {
@@ -30,7 +30,7 @@ void Instance_elx_conv_direct_vmg_t::__execute_a060(
       MD2(BiasType, abias0, bias, this->g, this->oc);
       MD2(BiasType, abias1, &md2(abias0, _g, 0), this->oc4, this->oc3 * this->O2 * V);
       MD4(TweightsType, atweights, tweights_, this->g, this->oc4, this->ic4,
-          V * C * this->kh * this->kw * this->ic3 * this->oc3 * this->I2
+          V * this->icg * this->kh * this->kw * this->ic3 * this->oc3 * this->I2
               * this->O2);
       MD5(InputType, ainput0, input, this->t3, this->ht, this->hs, this->iw,
           this->g * this->ic);
@@ -52,17 +52,20 @@ void Instance_elx_conv_direct_vmg_t::__execute_a060(
       MD2(BiasType, abias0, bias, this->g, this->oc);
       MD2(BiasType, abias1, &md2(abias0, _g, 0), this->oc4, this->oc3 * this->O2 * V);
       MD4(TweightsType, atweights, tweights_, this->g, this->oc4, this->ic4,
-          V * C * this->kh * this->kw * this->ic3 * this->oc3 * this->I2
+          V * this->icg * this->kh * this->kw * this->ic3 * this->oc3 * this->I2
               * this->O2);
-      MD7(InputType, ainput0, input, this->t3, this->g, this->ic4,
-          this->ic3 * this->I2, this->ht, this->hs, this->iw * V);
-      MD3(InputType, ainput1, &md7(ainput0, _t3, _g, _ic4, 0, _ht, 0, 0),
+      // G * icg channels of group _g, may start inside a V block
+      int ic2 = ALIGNUP(this->g * this->ic, V) / V;
+      int _ic = _g * this->ic + _ic4 * this->ic3 * this->I2 * V;
+      MD5(InputType, ainput0, input, this->t3, ic2, this->ht, this->hs,
+          this->iw * V);
+      MD3(InputType, ainput1, &md5(ainput0, _t3, _ic / V, _ht, 0, 0),
           this->wt, this->T * this->ws, V);
       MD6(OutputType, aoutput0, output, this->t3, this->g, this->oc4,
           this->oc3 * this->O2, this->ht, this->ow * V);
       MD3(OutputType, aoutput1, &md6(aoutput0, _t3, _g, _oc4, 0, _ht, 0),
           this->wt, this->T, V);
-      conv_a060(&md3(aoutput1, _wt, 0, 0), &md3(ainput1, _wt, 0, 0),
+      conv_a060(&md3(aoutput1, _wt, 0, 0), &md3(ainput1, _wt, 0, _ic % V),
           &md4(atweights, _g, _oc4, _ic4, 0), &md2(abias1, _oc4, 0),
           _ic4, _oc4, _ht, _wt);
     }, this->t3, this->g, this->ic4, this->oc4, this->ht, this->wt);
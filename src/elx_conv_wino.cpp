@@ -1,3 +1,4 @@
+#include "el_parallel.hpp"
 #include "elx_conv_wino.hpp"
 
 namespace euler {
@@ -79,8 +80,10 @@ Template_elx_conv_wino_t Instance_elx_conv_wino_t::elx_conv_wino_t(
   }
 #else
   if ((xopt_ == 0xa073 || xopt_ == 0xa07b || this->with_ip_sum)
-      && this->with_relu && !output_is_bfmt_) {
-    el_error("Unimplemented: fuse sum (plain format) and relu together");
+      && this->with_relu && !output_is_bfmt_
+      && !std::is_same<OutputType, float>::value) {
+    el_error("Unimplemented: fuse sum (plain format) and relu together "
+             "for non-fp32 output");
   }
 
   if (V * this->I2 * this->ic3 * this->ic4 != this->IC) {
@@ -231,6 +234,66 @@ void Instance_elx_conv_wino_t::set_trans_buffers()
   boutput_ = (OutputType *)((char *)bweights_ + bweights_size_);
 }
 
+// Observe mode: statistics of fp32 transformed input. Tiles are
+// transformed block by block into per-thread buffers, twice: range first,
+// then histogram.
+Template_elx_conv_wino_t
+void Instance_elx_conv_wino_t::observe_tinput(InputType *input)
+{
+  if (!std::is_same<TinputType, float>::value)
+    return;
+
+  elx_calib_stats_t &stats = this->calib->tinput;
+  size_t size = A * A * this->ic3 * this->I2 * this->T * V;
+  std::vector<float> tbuf(size * mthr_);
+  std::vector<float> tlo(mthr_, FLT_MAX), thi(mthr_, -FLT_MAX);
+  std::vector<std::vector<double>> thist(mthr_);
+
+  auto trans = [&](int ithr, int _t2, int _ic4, size_t &sz) {
+    int Tz = _t2 == (this->t2 - 1) ? this->Tr : this->T;
+    sz = A * A * this->ic3 * this->I2 * Tz * V;
+    float *tinput = &tbuf[ithr * size];
+    trans_input((TinputType *)tinput, input, Tz, _t2, _ic4);
+    return tinput;
+  };
+
+#pragma omp parallel num_threads(mthr_) proc_bind(close)
+  {
+    int ithr = omp_get_thread_num();
+    float l = FLT_MAX, h = -FLT_MAX;
+    thread_parallel_for<2>(mthr_, ithr, [&](int _t2, int _ic4) {
+      size_t sz;
+      float *tinput = trans(ithr, _t2, _ic4, sz);
+      for (size_t i = 0; i < sz; i++) {
+        l = estl::min(l, tinput[i]);
+        h = estl::max(h, tinput[i]);
+      }
+    }, this->t2, this->ic4);
+    tlo[ithr] = l;
+    thi[ithr] = h;
+  }
+
+  float lo = FLT_MAX, hi = -FLT_MAX;
+  iter_each (_i, mthr_) {
+    lo = estl::min(lo, tlo[_i]);
+    hi = estl::max(hi, thi[_i]);
+  }
+  stats.extend(lo, hi);
+
+#pragma omp parallel num_threads(mthr_) proc_bind(close)
+  {
+    int ithr = omp_get_thread_num();
+    thist[ithr].assign(elx_calib_stats_t::nbins, 0.0);
+    thread_parallel_for<2>(mthr_, ithr, [&](int _t2, int _ic4) {
+      size_t sz;
+      float *tinput = trans(ithr, _t2, _ic4, sz);
+      stats.accumulate(tinput, sz, thist[ithr].data());
+    }, this->t2, this->ic4);
+  }
+  iter_each (_i, mthr_)
+    stats.merge(thist[_i].data());
+}
+
 Template_elx_conv_wino_t
 Instance_elx_conv_wino_t::~elx_conv_wino_t()
 {
@@ -88,6 +88,8 @@ private:
   void __execute_a07b(OutputType *output, InputType *input,
       WeightsType *weights, BiasType *bias);
 
+  void observe_tinput(InputType *input);
+
   void set_trans_buffers();
   int prepare_execute_opt();
   void bind_execute_functions();
@@ -104,7 +104,8 @@ int Instance_elx_conv_wino_lp_t::prepare_execute_opt()
   size_t binput_size = 0, bweights_size = 0, boutput_size = 0;
   size_t tinput_u8_size = 0, tinput_quant_scale_size = 0,
       tweights_s8_size = 0,
-      tweights_quant_scale_size = 0, tweights_quant_factor_size = 0;
+      tweights_quant_scale_size = 0, tweights_quant_factor_size = 0,
+      output_quant_bias_size = 0;
 
   if (xopt_ & FUS_O) {
     this->oc3 /= this->oc4;
@@ -155,6 +156,10 @@ int Instance_elx_conv_wino_lp_t::prepare_execute_opt()
   tweights_s8_ = nullptr;
   tweights_quant_scale_ = nullptr;
   tweights_quant_factor_ = nullptr;
+  output_quant_bias_ = nullptr;
+
+  if (this->output_quant_per_oc)
+    output_quant_bias_size = this->OC * sizeof(BiasType);
 
   switch (xopt_) {
   case 0xa133:
@@ -219,10 +224,12 @@ int Instance_elx_conv_wino_lp_t::prepare_execute_opt()
   tweights_s8_size_ = tweights_s8_size > 0 ? alignup(tweights_s8_size, align) : 0;
   tweights_quant_scale_size_ = tweights_quant_scale_size > 0 ? alignup(tweights_quant_scale_size, align) : 0;
   tweights_quant_factor_size_ = tweights_quant_factor_size > 0 ? alignup(tweights_quant_factor_size, align) : 0;
+  output_quant_bias_size_ = output_quant_bias_size > 0 ? alignup(output_quant_bias_size, align) : 0;
 
   workspace_ = nullptr, scratch_ = nullptr;
   workspace_size_ = tweights_size_ + tweights_s8_size_
-      + tweights_quant_scale_size_ + tweights_quant_factor_size_;
+      + tweights_quant_scale_size_ + tweights_quant_factor_size_
+      + output_quant_bias_size_;
   size_t scratch_size = estl::max(tinput_size_, toutput_size_)
       + binput_size_ + bweights_size_ + boutput_size_ + tinput_u8_size_;
 
@@ -262,6 +269,7 @@ void Instance_elx_conv_wino_lp_t::set_workspace_buffers()
     } else {
       tweights_s8_ = (int8_t *)((char *)tweights_quant_factor_ + tweights_quant_factor_size_);
     }
+    output_quant_bias_ = (BiasType *)((char *)tweights_s8_ + tweights_s8_size_);
   }
 }
 
@@ -300,10 +308,26 @@ void Instance_elx_conv_wino_lp_t::prepare_quant_calibration(eld_conv_t &dc)
     this->output_quant_repS = 1 / this->output_quant_S;
     this->output_quant_z = (float)std::ceil(this->output_quant_z);
   }
+  // per-oc requantization is done before trans-output
+  if (this->output_quant_per_oc) {
+    this->output_quant_repS = 1.0f;
+    this->output_quant_z = 0.0f;
+  }
 }
 
 Template_elx_conv_wino_lp_t void Instance_elx_conv_wino_lp_t::
-trans_weights(WeightsType *weights) {
+trans_weights(WeightsType *weights, BiasType *bias) {
+  // bias' = bias * repS + z, with repS folded in tweights quant scale
+  auto requant_bias = [&]() {
+    if (!this->output_quant_per_oc)
+      return;
+    iter_each (_oc, this->OC) {
+      float b = (this->with_bias && _oc < this->oc) ? bias[_oc] : 0.0f;
+      output_quant_bias_[_oc] = b * this->output_quant_oc_repS[_oc]
+          + (float)std::ceil(this->output_quant_oc_z[_oc]);
+    }
+  };
+
   if (inference_acc_ && this->shared_workspace_enabled) {
     const char *key = this->shared_workspace_key.c_str();
     process_singleton_t process_singleton(key);
@@ -315,6 +339,7 @@ trans_weights(WeightsType *weights) {
       if (!this->shared_workspace_mgr->is_setup_done()) {
         trans_weights_s8(tweights_quant_scale_, tweights_quant_factor_,
                          tweights_s8_, tweights_, weights, this->oc4);
+        requant_bias();
         this->shared_workspace_mgr->set_setup_done();
       }
     }
@@ -323,6 +348,7 @@ trans_weights(WeightsType *weights) {
     set_workspace_buffers();
     trans_weights_s8(tweights_quant_scale_, tweights_quant_factor_,
                      tweights_s8_, tweights_, weights, this->oc4);
+    requant_bias();
   }
 }
 
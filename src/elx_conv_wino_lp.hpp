@@ -89,7 +89,7 @@ private:
   void (elx_conv_wino_lp_t::*execute_opt_)(
       OutputType *, InputType *, WeightsType *, BiasType *);
 
-  void trans_weights(WeightsType *weights);
+  void trans_weights(WeightsType *weights, BiasType *bias);
 
   // ??? XXX: Deduction error here
   elx_conv_wino_trans_input_t<uint8_t, InputType, I, A, K, V>
@@ -126,6 +126,7 @@ private:
   size_t tweights_s8_size_;
   size_t tweights_quant_scale_size_;
   size_t tweights_quant_factor_size_;
+  size_t output_quant_bias_size_;
   void *workspace_;
   void *scratch_;
 
@@ -140,6 +141,7 @@ private:
   int8_t *tweights_s8_;
   TscaleType *tweights_quant_scale_;
   TscaleType *tweights_quant_factor_;
+  BiasType *output_quant_bias_;
 };
 
 // fp32-u8s8f32
@@ -22,8 +22,10 @@ void Instance_elx_conv_wino_lp_t::__execute_a133(
     WeightsType * __restrict weights, BiasType * __restrict bias)
 {
   if (is_first_run_) {
-    trans_weights(weights);
+    trans_weights(weights, bias);
   }
+  if (this->output_quant_per_oc)
+    bias = output_quant_bias_;
 
   MD3(TweightsType, atweights, tweights_, this->oc4, this->ic4,
       A * A * this->ic3 * this->I2 * V * this->oc3 * this->O2 * V);
@@ -69,8 +71,10 @@ void Instance_elx_conv_wino_lp_t::__execute_a161(
     WeightsType * __restrict weights, BiasType * __restrict bias)
 {
   if (is_first_run_) {
-    trans_weights(weights);
+    trans_weights(weights, bias);
   }
+  if (this->output_quant_per_oc)
+    bias = output_quant_bias_;
 
 #pragma omp parallel num_threads(mthr_) proc_bind(close)
   {
@@ -122,8 +126,10 @@ void Instance_elx_conv_wino_lp_t::__execute_a173(
     WeightsType * __restrict weights, BiasType * __restrict bias)
 {
   if (is_first_run_) {
-    trans_weights(weights);
+    trans_weights(weights, bias);
   }
+  if (this->output_quant_per_oc)
+    bias = output_quant_bias_;
 
 #pragma omp parallel num_threads(mthr_) proc_bind(close)
   {
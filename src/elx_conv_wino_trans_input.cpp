@@ -369,7 +369,6 @@ void elx_conv_wino_trans_input_t<uint8_t, InputType, I, A, K, V>
     InputType *__restrict input, int _ic4)
 {
   __m<V> mrepS = _mm<V>::set1_ps(xc->input_quant_S * xc->tinput_quant_repS);
-  __m<V> mz = _mm<V>::set1_ps(xc->tinput_quant_z);
 
   int ithr = omp_get_thread_num();
   thread_parallel_for<4>(mthr_, ithr, [&](int _t2, int _ic3, int _I2, int _T) {
@@ -407,6 +406,7 @@ void elx_conv_wino_trans_input_t<uint8_t, InputType, I, A, K, V>
         iter_each (_wA, A) {
           // Min-Max quantization
           __m<V> a = *(__m<V> *)&aout[_hA][_wA][0];
+          __m<V> mz = _mm<V>::set1_ps(tinput_quant_z_[_hA][_wA]);
           __m<V> mresf32 = a * mrepS + mz;
           // convert to uint8
           __i<V> mresu32 = _mm<V>::cvt_roundps_epu32(
@@ -505,6 +505,9 @@ void elx_conv_wino_trans_input_t<uint8_t, InputType, I, A, K, V>
     uint8_t *__restrict tinput_u8, TinputType *__restrict tinput,
     InputType *__restrict input, int _ic4) {
   SET_EPI32(xc->ih * xc->iw);
+  // u8 input is padded with its zero point
+  InputType pad = std::is_same<InputType, uint8_t>::value
+      ? (InputType)xc->input_quant_z : (InputType)0;
 
   auto readin = [&](InputType ain[A][A][V], int _t2, int _ic3, int _I2, int _T,
                     bool is_Ir) {
@@ -520,7 +523,7 @@ void elx_conv_wino_trans_input_t<uint8_t, InputType, I, A, K, V>
           if (_hA < _hA_start || _hA > _hA_end || _wA < _wA_start ||
               _wA > _wA_end) {
 #pragma omp simd
-            iter_each(_V, V) ain[_hA][_wA][_V] = 0.0f;
+            iter_each(_V, V) ain[_hA][_wA][_V] = pad;
           } else {
 #pragma omp simd
             iter_each(_V, xc->Ir) ain[_hA][_wA][_V] =
@@ -534,7 +537,7 @@ void elx_conv_wino_trans_input_t<uint8_t, InputType, I, A, K, V>
           if (_hA < _hA_start || _hA > _hA_end || _wA < _wA_start ||
               _wA > _wA_end) {
 #pragma omp simd
-            iter_each(_V, V) ain[_hA][_wA][_V] = 0.0f;
+            iter_each(_V, V) ain[_hA][_wA][_V] = pad;
           } else {
             if (I == ISA_SKX_AVX512 && std::is_same<InputType, float>::value) {
               constexpr int scale = sizeof(InputType);
@@ -553,7 +556,6 @@ void elx_conv_wino_trans_input_t<uint8_t, InputType, I, A, K, V>
   };
 
   __m<V> mrepS = _mm<V>::set1_ps(xc->input_quant_S * xc->tinput_quant_repS);
-  __m<V> mz = _mm<V>::set1_ps(xc->tinput_quant_z);
   int ithr = omp_get_thread_num();
   thread_parallel_for<3>(mthr_, ithr, [&](int _t2, int _ic3, int _I2) {
     // n, ic2, ih, iw, V => t2, hA, wA, ic3, I2, T, V
@@ -574,6 +576,7 @@ void elx_conv_wino_trans_input_t<uint8_t, InputType, I, A, K, V>
       iter_each (_wA, A) {
         // Min-Max quantization
         __m<V> a = *(__m<V> *)&aout[_hA][_wA][0];
+        __m<V> mz = _mm<V>::set1_ps(tinput_quant_z_[_hA][_wA]);
         __m<V> mresf32 = a * mrepS + mz;
         // convert to uint8
         __i<V> mresu32 = _mm<V>::cvt_roundps_epu32(
@@ -619,7 +622,6 @@ void elx_conv_wino_trans_input_t<uint8_t, InputType, I, A, K, V>
 
   if (xc->sampling_kind == CALIBRATED) {
     __m<V> mrepS = _mm<V>::set1_ps(xc->input_quant_S * xc->tinput_quant_repS);
-    __m<V> mz = _mm<V>::set1_ps(xc->tinput_quant_z);
     alignas(64) op_type aout[A][A][V];
 
     iter_each(_ic3, xc->ic3) {
@@ -645,6 +647,7 @@ void elx_conv_wino_trans_input_t<uint8_t, InputType, I, A, K, V>
         iter_each (_wA, A) {
           // Min-Max quantization
           __m<V> a = *(__m<V> *)&aout[_hA][_wA][0];
+          __m<V> mz = _mm<V>::set1_ps(tinput_quant_z_[_hA][_wA]);
           __m<V> mresf32 = a * mrepS + mz;
           // convert to uint8
           __i<V> mresu32 = _mm<V>::cvt_roundps_epu32(
@@ -819,6 +822,9 @@ void elx_conv_wino_trans_input_t<uint8_t, InputType, I, A, K, V>
   alignas(64) op_type aout[A][A][V];
   alignas(64) InputType ain[A][A][V];
   SET_EPI32(xc->ih * xc->iw);
+  // u8 input is padded with its zero point
+  InputType pad = std::is_same<InputType, uint8_t>::value
+      ? (InputType)xc->input_quant_z : (InputType)0;
 
   auto readin = [&](InputType ain[A][A][V], int _ic3, int _I2, int _T, bool is_Ir) {
     MD2(InputType, ainput0, input, xc->n, xc->ic * xc->ih * xc->iw);
@@ -833,7 +839,7 @@ void elx_conv_wino_trans_input_t<uint8_t, InputType, I, A, K, V>
         if (_hA < _hA_start || _hA > _hA_end || _wA < _wA_start
             || _wA > _wA_end) {
 #pragma omp simd
-          iter_each (_V, V) ain[_hA][_wA][_V] = 0;
+          iter_each (_V, V) ain[_hA][_wA][_V] = pad;
         } else {
           iter_each(_V, xc->Ir) {
             ain[_hA][_wA][_V] =
@@ -850,7 +856,7 @@ void elx_conv_wino_trans_input_t<uint8_t, InputType, I, A, K, V>
         if (_hA < _hA_start || _hA > _hA_end || _wA < _wA_start
             || _wA > _wA_end) {
 #pragma omp simd
-          iter_each (_V, V) ain[_hA][_wA][_V] = 0;
+          iter_each (_V, V) ain[_hA][_wA][_V] = pad;
         } else {
 #pragma omp simd
           iter_each (_V, V)
@@ -862,7 +868,6 @@ void elx_conv_wino_trans_input_t<uint8_t, InputType, I, A, K, V>
   };
 
   __m<V> mrepS = _mm<V>::set1_ps(xc->input_quant_S * xc->tinput_quant_repS);
-  __m<V> mz = _mm<V>::set1_ps(xc->tinput_quant_z);
   MD6(uint8_t, atinput_u8, tinput_u8, A, A, xc->ic3, xc->I2, Tz, V);
 
   iter_each (_ic3, xc->ic3) {
@@ -876,6 +881,7 @@ void elx_conv_wino_trans_input_t<uint8_t, InputType, I, A, K, V>
       iter_each (_wA, A) {
         // Min-Max quantization
         __m<V> a = *(__m<V> *)&aout[_hA][_wA][0];
+        __m<V> mz = _mm<V>::set1_ps(tinput_quant_z_[_hA][_wA]);
         __m<V> mresf32 = a * mrepS + mz;
         // convert to uint8
         __i<V> mresu32 = _mm<V>::cvt_roundps_epu32(
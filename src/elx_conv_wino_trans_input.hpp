@@ -151,6 +151,34 @@ public:
   elx_conv_wino_trans_input_t() {}
   virtual ~elx_conv_wino_trans_input_t() {}
 
+  void setup(elx_conv_params_t *conv_xc) {
+    super::setup(conv_xc);
+
+    // u8 input with zero point z: T(S * (x - z)) = S * T(x) - S * z * T(1).
+    // Fold the compensation into a per (hA, wA) zero point of tinput
+    iter_each (_hA, A) {
+    iter_each (_wA, A) {
+      tinput_quant_z_[_hA][_wA] = xc->tinput_quant_z;
+    }}
+    if (std::is_same<InputType, uint8_t>::value
+        && xc->sampling_kind == CALIBRATED && xc->input_quant_z != 0) {
+      alignas(64) float ain[A][A][V];
+      alignas(64) float aout[A][A][V];
+      iter_each (_hA, A) {
+      iter_each (_wA, A) {
+      iter_each (_V, V) {
+        ain[_hA][_wA][_V] = 1.0f;
+      }}}
+      elk_conv_wino_trans_input<float, float, TKF_COMPACT, false, I, A, V>
+          ::execute(*xc, (float *)&aout, (float *)&ain, 0, 0, 0, -1);
+      float zS = xc->input_quant_z * xc->input_quant_S * xc->tinput_quant_repS;
+      iter_each (_hA, A) {
+      iter_each (_wA, A) {
+        tinput_quant_z_[_hA][_wA] -= zS * aout[_hA][_wA][0];
+      }}
+    }
+  }
+
   void execute(TscaleType *__restrict tinput_quant_scale,
       uint8_t *__restrict t_input_u8,
       TinputType *__restrict t_input,
@@ -202,6 +230,8 @@ protected:
 
   using super::ker_trans_input_;
   using super::ker_trans_input0_;
+
+  float tinput_quant_z_[A][A];
 };
 
 // Three stage indexing, width, hight, image
@@ -18,6 +18,10 @@ void elx_conv_wino_trans_output_t<OutputType, BiasType, ToutputType, I, A, K,
       : false;
   output_is_bfmt_ = xc->output_fmt == nChw16c;
   output_as_bfmt_ = xc->output_fmt == nchw && xc->output_as_blocked;
+  // nchw: ip-sum (and ic4 partial sums) are added after the kernel
+  act_after_sum_ = std::is_same<OutputType, float>::value && xc->with_relu
+      && xc->output_fmt == nchw
+      && (xc->with_ip_sum || (!output_as_bfmt_ && xc->ic4 > 1));
 
   if (xc->Or != V && xc->output_fmt == nhwc) {
     el_error("Unimplemented: nhwc output with Or");
@@ -81,27 +85,32 @@ void elx_conv_wino_trans_output_t<OutputType, BiasType, ToutputType, I, A, K,
        {{E(TKF_NHWC, 0, 1, 1, 0), E(TKF_NHWC, 1, 1, 1, 0)},
         {E(TKF_NHWC, 0, 1, 1, 1), E(TKF_NHWC, 1, 1, 1, 1)}}}};
 
+  // per-oc requantization z is carried by the fused bias
+  bool with_bias = xc->with_bias || xc->output_quant_per_oc;
+  bool with_relu = xc->with_relu && !act_after_sum_;
+  // blocked output of nchw is summed to user output after conv
+  bool with_ip_sum = xc->with_ip_sum && !output_as_bfmt_;
   if (output_is_bfmt_ || output_as_bfmt_) {
     ker_trans_output_ =
-      D_ktable[xc->with_bias][xc->with_relu][xc->with_ip_sum].f1_;
+      D_ktable[with_bias][with_relu][with_ip_sum].f1_;
     ker_trans_output0_ =
-      D_ktable[xc->with_bias][xc->with_relu][xc->with_ip_sum].f2_;
-    ker_trans_output_acc_ = D_ktable[xc->with_bias][xc->with_relu][1].f1_;
-    ker_trans_output0_acc_ = D_ktable[xc->with_bias][xc->with_relu][1].f2_;
+      D_ktable[with_bias][with_relu][with_ip_sum].f2_;
+    ker_trans_output_acc_ = D_ktable[with_bias][with_relu][1].f1_;
+    ker_trans_output0_acc_ = D_ktable[with_bias][with_relu][1].f2_;
   } else if (xc->output_fmt == nhwc) {
     ker_trans_output_ =
-      F_ktable[xc->with_bias][xc->with_relu][xc->with_ip_sum].f1_;
+      F_ktable[with_bias][with_relu][with_ip_sum].f1_;
     ker_trans_output0_ =
-      F_ktable[xc->with_bias][xc->with_relu][xc->with_ip_sum].f2_;
-    ker_trans_output_acc_ = F_ktable[xc->with_bias][xc->with_relu][1].f1_;
-    ker_trans_output0_acc_ = F_ktable[xc->with_bias][xc->with_relu][1].f2_;
+      F_ktable[with_bias][with_relu][with_ip_sum].f2_;
+    ker_trans_output_acc_ = F_ktable[with_bias][with_relu][1].f1_;
+    ker_trans_output0_acc_ = F_ktable[with_bias][with_relu][1].f2_;
   } else {  // nchw
     ker_trans_output_ =
-      C_ktable[xc->with_bias][xc->with_relu][xc->with_ip_sum].f1_;
+      C_ktable[with_bias][with_relu][with_ip_sum].f1_;
     ker_trans_output0_ =
-      C_ktable[xc->with_bias][xc->with_relu][xc->with_ip_sum].f2_;
-    ker_trans_output_acc_ = C_ktable[xc->with_bias][xc->with_relu][1].f1_;
-    ker_trans_output0_acc_ = C_ktable[xc->with_bias][xc->with_relu][1].f2_;
+      C_ktable[with_bias][with_relu][with_ip_sum].f2_;
+    ker_trans_output_acc_ = C_ktable[with_bias][with_relu][1].f1_;
+    ker_trans_output0_acc_ = C_ktable[with_bias][with_relu][1].f2_;
   }
 }
 
@@ -140,9 +149,14 @@ void elx_conv_wino_trans_output_t<OutputType, BiasType, ToutputType, I, A, K,
     MD6(OutputType, aoutput1, &md2(aoutput0, _n, 0), xc->oc4, xc->oc3,
         xc->O2, V, xc->oh, xc->ow);
 
+    bool sum_act = act_after_sum_ && (_ic4 == -1 || _ic4 == xc->ic4 - 1);
     for (int _hA = 0; _hA <= _hOA_end; ++_hA) {
       for (int _wA = 0; _wA <= _wOA_end; ++_wA) {
-        if (is_Or) {
+        if (sum_act) {
+          xc->template sum_activate_plain<V>((float *)&md6(aoutput1, _oc4,
+              _oc3, _O2, 0, _oh + _hA, _ow + _wA), vindex,
+              *(__m<V> *)aout[_hA][_wA], is_Or ? xc->Or : V);
+        } else if (is_Or) {
           if ((xc->with_ip_sum && !output_as_bfmt_) || _ic4 > 0) {
             iter_each (_V, xc->Or)
               md6(aoutput1, _oc4, _oc3, _O2, _V, _oh + _hA, _ow + _wA)
@@ -215,12 +229,10 @@ void elx_conv_wino_trans_output_t<OutputType, BiasType, ToutputType, I, A, K,
     V>::__execute_blocked(OutputType *output, ToutputType *toutput,
     BiasType *bias, int Tz, int _t2, int _oc4, int _ic4)
 {
-  auto ker_trans_output = (xc->with_ip_sum || _ic4 > 0)
-      ? ker_trans_output_acc_
-      : ker_trans_output_;
-  auto ker_trans_output_tail = (xc->with_ip_sum || _ic4 > 0)
-      ? ker_trans_output0_acc_
-      : ker_trans_output0_;
+  bool acc = (xc->with_ip_sum && !output_as_bfmt_) || _ic4 > 0;
+  auto ker_trans_output = acc ? ker_trans_output_acc_ : ker_trans_output_;
+  auto ker_trans_output_tail
+      = acc ? ker_trans_output0_acc_ : ker_trans_output0_;
 
   // A, A, oc3, O2, T, V -> n, oc2, oh, ow, V
   MD6(ToutputType, atoutput, toutput, A, A, xc->oc3, xc->O2, Tz, V);
@@ -282,12 +294,10 @@ void elx_conv_wino_trans_output_t<OutputType, BiasType, ToutputType, I, A, K,
     V>::__execute_nhwc(OutputType *output, ToutputType *toutput, BiasType *bias,
     int Tz, int _t2, int _oc4, int _ic4)
 {
-  auto ker_trans_output = (xc->with_ip_sum || _ic4 > 0)
-      ? ker_trans_output_acc_
-      : ker_trans_output_;
-  auto ker_trans_output_tail = (xc->with_ip_sum || _ic4 > 0)
-      ? ker_trans_output0_acc_
-      : ker_trans_output0_;
+  bool acc = (xc->with_ip_sum && !output_as_bfmt_) || _ic4 > 0;
+  auto ker_trans_output = acc ? ker_trans_output_acc_ : ker_trans_output_;
+  auto ker_trans_output_tail
+      = acc ? ker_trans_output0_acc_ : ker_trans_output0_;
 
   // A, A, oc3, O2, T, V -> n, oc2, oh, ow, V
   MD6(ToutputType, atoutput, toutput, A, A, xc->oc3, xc->O2, Tz, V);
@@ -362,12 +372,10 @@ void elx_conv_wino_trans_output_t<OutputType, BiasType, ToutputType, I, A, K,
     V>::__execute_blocked(OutputType *output, ToutputType *toutput,
     BiasType *bias, int _oc4, int _ic4)
 {
-  auto ker_trans_output = (xc->with_ip_sum || _ic4 > 0)
-      ? ker_trans_output_acc_
-      : ker_trans_output_;
-  auto ker_trans_output_tail = (xc->with_ip_sum || _ic4 > 0)
-      ? ker_trans_output0_acc_
-      : ker_trans_output0_;
+  bool acc = (xc->with_ip_sum && !output_as_bfmt_) || _ic4 > 0;
+  auto ker_trans_output = acc ? ker_trans_output_acc_ : ker_trans_output_;
+  auto ker_trans_output_tail
+      = acc ? ker_trans_output0_acc_ : ker_trans_output0_;
 
   int ithr = omp_get_thread_num();
   thread_parallel_for<4>(mthr_, ithr,
@@ -428,12 +436,10 @@ void elx_conv_wino_trans_output_t<OutputType, BiasType, ToutputType, I, A, K,
     V>::__execute_nhwc(OutputType *output, ToutputType *toutput, BiasType *bias,
     int _oc4, int _ic4)
 {
-  auto ker_trans_output = (xc->with_ip_sum || _ic4 > 0)
-      ? ker_trans_output_acc_
-      : ker_trans_output_;
-  auto ker_trans_output_tail = (xc->with_ip_sum || _ic4 > 0)
-      ? ker_trans_output0_acc_
-      : ker_trans_output0_;
+  bool acc = (xc->with_ip_sum && !output_as_bfmt_) || _ic4 > 0;
+  auto ker_trans_output = acc ? ker_trans_output_acc_ : ker_trans_output_;
+  auto ker_trans_output_tail
+      = acc ? ker_trans_output0_acc_ : ker_trans_output0_;
 
   int ithr = omp_get_thread_num();
   thread_parallel_for<3>(mthr_, ithr,
@@ -502,9 +508,14 @@ void elx_conv_wino_trans_output_t<OutputType, BiasType, ToutputType, I, A, K,
     MD6(OutputType, aoutput1, &md2(aoutput0, _n, 0), xc->oc4, xc->oc3,
         xc->O2, V, xc->oh, xc->ow);
 
+    bool sum_act = act_after_sum_ && (_ic4 == -1 || _ic4 == xc->ic4 - 1);
     for (int _hA = 0; _hA <= _hOA_end; ++_hA) {
       for (int _wA = 0; _wA <= _wOA_end; ++_wA) {
-        if (is_Or) {
+        if (sum_act) {
+          xc->template sum_activate_plain<V>((float *)&md6(aoutput1, _oc4,
+              _oc3, _O2, 0, _oh + _hA, _ow + _wA), vindex,
+              *(__m<V> *)aout[_hA][_wA], is_Or ? xc->Or : V);
+        } else if (is_Or) {
           if ((xc->with_ip_sum && !output_as_bfmt_) || (_ic4 > 0)) {
 #pragma omp simd
             iter_each (_V, xc->Or)
@@ -45,6 +45,9 @@ public:
     execute(output, toutput, bias, _oc4, _ic4);
   }
 
+  // nchw output sums after the kernel, activation applied after the sum
+  bool act_after_sum() const { return act_after_sum_; }
+
   private:
   inline void __execute_nhwc(OutputType *output, ToutputType *toutput,
       BiasType *bias, int Tz, int _t2, int _oc4, int _ic4);
@@ -74,6 +77,7 @@ public:
   bool stream_out_;
   bool output_is_bfmt_;
   bool output_as_bfmt_;
+  bool act_after_sum_;
 
   int hOA_end_;
   int wOA_end_;
@@ -533,6 +533,12 @@ void elx_conv_wino_trans_weights_t<int8_t, WeightsType, I, A, K, V>
     float Sw =
         md8(atweights_quant_scale, _oc4, _ic4, _oc3, _hA, _wA, _O1, _O, _oV);
     Sw /= INT8GEMM_TWT_QTSCALE;
+    // fold per-oc requantization scale, linear to output transform
+    if (xc->output_quant_per_oc) {
+      MD5(float, aoutput_quant_repS, xc->output_quant_oc_repS.data(),
+          oc4, xc->oc3, xc->O1, xc->O, V);
+      Sw *= md5(aoutput_quant_repS, _oc4, _oc3, _O1, _O, _oV);
+    }
     float Zw =
         md8(atweights_quant_factor, _oc4, _ic4, _oc3, _hA, _wA, _O1, _O, _oV);
     if (xc->sampling_kind == CALIBRATED) {
@@ -312,10 +312,12 @@ void Instance_elx_conv_wino_t::execute(
 {
   set_trans_buffers();
 
-  if (is_bfmt_)
-    return (this->*execute_opt_)((OutputType *)output,
+  if (is_bfmt_) {
+    (this->*execute_opt_)((OutputType *)output,
         (InputType *)input, (WeightsType *)weights, (BiasType *)bias);
-  else {
+    if (this->calib != nullptr)
+      observe_tinput((InputType *)input);
+  } else {
     InputType *in = (InputType *)input;
     WeightsType *wei = (WeightsType *)weights;
     OutputType *out = output_as_bfmt_ ? boutput_ : (OutputType *)output;
@@ -360,6 +362,8 @@ void Instance_elx_conv_wino_t::execute(
 
     (this->*execute_opt_)((OutputType *)out,
         (InputType *)in, (WeightsType *)wei, (BiasType *)bias);
+    if (this->calib != nullptr)
+      observe_tinput(in);
 
     if (output_as_bfmt_) {
       parallel_for<3>(mthr_, [&](int _n, int _oc2, int _oh) {
@@ -367,7 +371,14 @@ void Instance_elx_conv_wino_t::execute(
         MD4(OutputType, aoutput, (OutputType *)output, this->n, this->oc, this->oh, this->ow);
 
         int v = _oc2 == this->oc2 - 1 ? this->Or : V;
-        if (this->with_ip_sum) {
+        if (trans_output.act_after_sum()) {
+          SET_EPI32(this->oh * this->ow)
+          iter_each (_ow, this->ow) {
+            this->template sum_activate_plain<V>(
+                (float *)&md4(aoutput, _n, _oc2 * V, _oh, _ow), vindex,
+                *(__m<V> *)&md5(aboutput, _n, _oc2, _oh, _ow, 0), v);
+          }
+        } else if (this->with_ip_sum) {
           iter_each (_V, v) {
           iter_each (_ow, this->ow) {
             md4(aoutput, _n, _oc2 * V + _V, _oh, _ow)
@@ -0,0 +1,116 @@
+#include <string.h>
+#include "el_stl.hpp"
+#include "el_utils.hpp"
+#include "el_parallel.hpp"
+#include "elx_deconv_direct_lp.hpp"
+
+namespace euler {
+
+Template_elx_deconv_direct_lp_t
+Instance_elx_deconv_direct_lp_t::elx_deconv_direct_lp_t(eld_conv_t &dc)
+    : elx_conv_t(dc)
+{
+  if (this->hs != 1 || this->ws != 1 || this->hd != 1 || this->wd != 1) {
+    el_error("INT8 deconv: stride/dilation > 1 not supported");
+  }
+  if (dc.pads.l >= this->kw || dc.pads.r >= this->kw ||
+      dc.pads.t >= this->kh || dc.pads.b >= this->kh) {
+    el_error("INT8 deconv: padding must be less than kernel size");
+  }
+
+  // Equivalent direct convolution: flipped weights, padding (k - 1 - p)
+  conv_.dims = dc.dims;
+  conv_.pads = { this->kw - 1 - dc.pads.l, this->kw - 1 - dc.pads.r,
+                 this->kh - 1 - dc.pads.t, this->kh - 1 - dc.pads.b };
+  conv_.strides = dc.strides;
+  conv_.dilations = dc.dilations;
+  conv_.data_type = dc.data_type;
+  conv_.formats = dc.formats;
+  conv_.prop_kind = dc.prop_kind;
+  conv_.algorithm = CONV_DIRECT;
+  conv_.with_relu = dc.with_relu;
+  conv_.activation = dc.activation;
+  conv_.with_bias = this->with_bias;
+  conv_.with_ip_sum = dc.with_ip_sum;
+  conv_.with_op_sum = dc.with_op_sum;
+  conv_.with_argmax = dc.with_argmax;
+  conv_.f16c_opt = dc.f16c_opt;
+  conv_.is_inference = dc.is_inference;
+  conv_.use_scratch_pad = dc.use_scratch_pad;
+  conv_.disable_autoparam = dc.disable_autoparam;
+  conv_.eager_mode = dc.eager_mode;
+  conv_.stream_sync = dc.stream_sync;
+  conv_.nthreads = dc.nthreads;
+  // a060 of deconv maps to a160 of int8 direct
+  conv_.execution_mode = estl::any_of(dc.execution_mode, 0xa160, 0xd160)
+      ? dc.execution_mode : 0xa160;
+  conv_.flatting = dc.flatting;
+  conv_.blocking = dc.blocking;
+  conv_.partition = dc.partition;
+  conv_.streaming_hint = dc.streaming_hint;
+  conv_.format_as_blocked = dc.format_as_blocked;
+  conv_.input_quant = dc.input_quant;
+  conv_.wino_tinput_quant = dc.wino_tinput_quant;
+  conv_.output_quant = dc.output_quant;
+  conv_.sum_quant = dc.sum_quant;
+  conv_.output_quant_oc = dc.output_quant_oc;
+  conv_.sampling_kind = dc.sampling_kind;
+  conv_.scratch_pad = dc.scratch_pad;
+  conv_.shared_workspace_key = dc.shared_workspace_key;
+  if (conv_.setup() != ELD_OK) {
+    el_error("INT8 deconv: direct convolution setup error");
+  }
+
+  int g = this->g, ic = this->ic / g, oc = this->oc / g;
+  if (estl::any_of(this->weights_fmt, OIhw16i16o, gOIhw16i16o)) {
+    wouter_ = (size_t)g * (ALIGNUP(oc, V) / V) * (ALIGNUP(ic, V) / V);
+    winner_ = V * V;
+  } else if (estl::any_of(this->weights_fmt, oihw, goihw)) {
+    wouter_ = (size_t)g * oc * ic;
+    winner_ = 1;
+  } else if (estl::any_of(this->weights_fmt, hwio, ghwio)) {
+    wouter_ = g;
+    winner_ = (size_t)ic * oc;
+  } else {
+    el_error("INT8 deconv: weights format not supported");
+  }
+  fweights_ = nullptr;
+  MEMALIGN64(&fweights_, conv_.byte_sizes.weights);
+
+  is_first_run_ = true;
+  inference_acc_ = this->prop_kind == forward_inference;
+}
+
+Template_elx_deconv_direct_lp_t
+Instance_elx_deconv_direct_lp_t::~elx_deconv_direct_lp_t()
+{
+  if (fweights_ != nullptr)
+    ::free(fweights_);
+}
+
+// weights: outer, kh, kw, inner => outer, kh - 1 - _kh, kw - 1 - _kw, inner
+Template_elx_deconv_direct_lp_t
+void Instance_elx_deconv_direct_lp_t::trans_weights_flip(
+    WeightsType *fweights, WeightsType *weights)
+{
+  parallel_for<3>(omp_get_max_threads(), [&](int _o, int _kh, int _kw) {
+    MD4(WeightsType, aweights, weights, wouter_, this->kh, this->kw, winner_);
+    MD4(WeightsType, afweights, fweights, wouter_, this->kh, this->kw, winner_);
+    memcpy(&md4(afweights, _o, this->kh - 1 - _kh, this->kw - 1 - _kw, 0),
+           &md4(aweights, _o, _kh, _kw, 0), winner_ * sizeof(WeightsType));
+  }, (int)wouter_, this->kh, this->kw);
+}
+
+Template_elx_deconv_direct_lp_t
+void Instance_elx_deconv_direct_lp_t::execute(
+    void *output, void *input, void *weights, void *bias)
+{
+  if (is_first_run_)
+    trans_weights_flip(fweights_, (WeightsType *)weights);
+  if (inference_acc_)
+    is_first_run_ = false;
+
+  conv_.xc->execute(output, input, fweights_, bias);
+}
+
+} // namespace euler
@@ -0,0 +1,55 @@
+#ifndef __ELX_DECONV_DIRECT_LP_HPP__
+#define __ELX_DECONV_DIRECT_LP_HPP__
+
+#include "euler.hpp"
+#include "el_def.hpp"
+#include "el_utils.hpp"
+#include "elx_conv.hpp"
+
+// INT8 deconvolution, stride 1.
+//
+// A stride 1 deconvolution is a direct convolution with spatially flipped
+// weights and padding (k - 1 - p). Execution is delegated to the int8
+// direct convolution (elx_conv_direct_lp_t and u8s8 conv kernels) of an
+// internal descriptor, sharing its calibrated quantization path.
+
+namespace euler {
+
+#define Template_elx_deconv_direct_lp_t                                        \
+  template <typename UserTypes, typename TarrayTypes, const int V, const int I>
+
+#define Instance_elx_deconv_direct_lp_t                                        \
+  elx_deconv_direct_lp_t<UserTypes, TarrayTypes, V, I>
+
+Template_elx_deconv_direct_lp_t class elx_deconv_direct_lp_t : public elx_conv_t {
+  using InputType = typename UserTypes::InputType;
+  using WeightsType = typename UserTypes::WeightsType;
+  using OutputType = typename UserTypes::OutputType;
+  using BiasType = typename UserTypes::BiasType;
+
+  public:
+  elx_deconv_direct_lp_t(eld_conv_t &dc);
+  virtual ~elx_deconv_direct_lp_t();
+
+  virtual void execute(void *output, void *input, void *weights, void *bias);
+
+  private:
+  void trans_weights_flip(WeightsType *fweights, WeightsType *weights);
+
+  // Equivalent direct convolution
+  eld_conv_t conv_;
+
+  bool is_first_run_;
+  bool inference_acc_;
+
+  // weights: outer, kh, kw, inner
+  size_t wouter_, winner_;
+  WeightsType *fweights_;
+};
+
+template class elx_deconv_direct_lp_t<conv::U8F32U8F32, conv_impl::INT8_F32, 16, ISA_SKX_AVX512>;
+template class elx_deconv_direct_lp_t<conv::U8F32S8F32, conv_impl::INT8_F32, 16, ISA_SKX_AVX512>;
+template class elx_deconv_direct_lp_t<conv::U8F32F32F32, conv_impl::INT8_F32, 16, ISA_SKX_AVX512>;
+
+} // namespace euler
+#endif // __ELX_DECONV_DIRECT_LP_HPP__
@@ -0,0 +1,223 @@
+#include <string.h>
+#include "el_stl.hpp"
+#include "el_utils.hpp"
+#include "el_parallel.hpp"
+#include "elx_deconv_subpixel.hpp"
+
+namespace euler {
+
+// Phase _p of a stride s deconvolution along one dimension: sub-kernel
+// size K, first output o0, number of outputs n, and the top/bottom padding
+// (pt, pb) of the equivalent stride 1 convolution over input size i.
+static inline void __phase_dim(int _p, int s, int k, int p, int i, int o,
+    int &K, int &o0, int &n, int &pt, int &pb)
+{
+  K = (k - _p + s - 1) / s;
+  o0 = ((_p - p) % s + s) % s;
+  n = o0 < o ? (o - 1 - o0) / s + 1 : 0;
+  int q0 = (o0 + p - _p) / s;
+  pt = K - 1 - q0;
+  pb = q0 + n - i;
+}
+
+Template_elx_deconv_subpixel_t
+Instance_elx_deconv_subpixel_t::elx_deconv_subpixel_t(eld_conv_t &dc)
+    : elx_conv_t(dc)
+{
+  mthr_ = omp_get_max_threads();
+
+  if (this->hd != 1 || this->wd != 1) {
+    el_error("subpixel: dilation > 1 not supported");
+  }
+  if (this->with_ip_sum) {
+    el_error("subpixel: inplace sum not supported");
+  }
+  bool format_ok =
+      estl::any_of(this->weights_fmt, hwio, ghwio, OIhw16i16o, gOIhw16i16o) &&
+      estl::any_of(this->input_fmt, nChw16c, nhwc) &&
+      this->output_fmt == this->input_fmt;
+  if (!format_ok) {
+    el_error("subpixel: format not supported");
+  }
+
+  int g = this->g, ic = this->ic / g, oc = this->oc / g;
+  if (estl::any_of(this->weights_fmt, OIhw16i16o, gOIhw16i16o)) {
+    wouter_ = (size_t)g * (ALIGNUP(oc, V) / V) * (ALIGNUP(ic, V) / V);
+    winner_ = V * V;
+  } else {
+    wouter_ = g;
+    winner_ = (size_t)ic * oc;
+  }
+
+  np_ = this->hs * this->ws;
+  phases_ = new phase_t[np_];
+  size_t weights_size = 0, output_size = 0;
+  iter_each (_p, np_) {
+    auto &p = phases_[_p];
+    setup_phase(dc, p, _p / this->ws, _p % this->ws);
+    if (p.conv == nullptr) continue;
+    weights_size += p.conv->byte_sizes.weights;
+    output_size = estl::max(output_size, p.conv->byte_sizes.output);
+  }
+
+  // Phases run one after another and share the output buffer
+  workspace_ = nullptr;
+  MEMALIGN64(&workspace_, weights_size + output_size);
+  char *ptr = (char *)workspace_;
+  iter_each (_p, np_) {
+    auto &p = phases_[_p];
+    if (p.conv == nullptr) continue;
+    p.weights = (WeightsType *)ptr;
+    ptr += p.conv->byte_sizes.weights;
+  }
+  iter_each (_p, np_) {
+    phases_[_p].output = (OutputType *)ptr;
+  }
+
+  is_first_run_ = true;
+  inference_acc_ = this->prop_kind == forward_inference;
+}
+
+Template_elx_deconv_subpixel_t
+void Instance_elx_deconv_subpixel_t::setup_phase(
+    eld_conv_t &dc, phase_t &p, int _ph, int _pw)
+{
+  int pt, pb, pl, pr;
+  __phase_dim(_ph, this->hs, this->kh, dc.pads.t, this->ih, this->oh,
+              p.kh, p.oh0, p.oh, pt, pb);
+  __phase_dim(_pw, this->ws, this->kw, dc.pads.l, this->iw, this->ow,
+              p.kw, p.ow0, p.ow, pl, pr);
+
+  p.conv = nullptr;
+  if (p.kh == 0 || p.kw == 0) {
+    el_error("subpixel: kernel smaller than stride not supported");
+  }
+  if (p.oh == 0 || p.ow == 0)
+    return;
+  if (pt < 0 || pl < 0) {
+    el_error("subpixel: padding not supported");
+  }
+
+  p.conv = new eld_conv_t;
+  auto &c = *p.conv;
+  c.dims = dc.dims;
+  c.dims.oh = p.oh;
+  c.dims.ow = p.ow;
+  c.dims.kh = p.kh;
+  c.dims.kw = p.kw;
+  c.pads = { pl, pr, pt, pb };
+  c.strides = { 1, 1 };
+  c.dilations = { 1, 1 };
+  c.data_type = dc.data_type;
+  c.formats = dc.formats;
+  c.prop_kind = dc.prop_kind;
+  c.tile_size = dc.tile_size;
+  c.with_relu = dc.with_relu;
+  c.activation = dc.activation;
+  c.with_bias = this->with_bias;
+  c.f16c_opt = dc.f16c_opt;
+  c.is_inference = dc.is_inference;
+  c.use_scratch_pad = dc.use_scratch_pad;
+  c.disable_autoparam = dc.disable_autoparam;
+  c.eager_mode = dc.eager_mode;
+  c.stream_sync = dc.stream_sync;
+  c.nthreads = dc.nthreads;
+  c.flatting = dc.flatting;
+  c.blocking = dc.blocking;
+  c.partition = dc.partition;
+  c.streaming_hint = dc.streaming_hint;
+  c.format_as_blocked = dc.format_as_blocked;
+  c.scratch_pad = dc.scratch_pad;
+  c.shared_workspace_key = dc.shared_workspace_key;
+
+  // Winograd for 3x3/pad-1 phases, a060 for the shapes of its kernels,
+  // d060 (gemm per kw) otherwise
+  auto half_or_zero = [](int pad, int k) {
+    return estl::any_of(pad, 0, k / 2);
+  };
+  if (p.kh == 3 && p.kw == 3 && pt == 1 && pb == 1 && pl == 1 && pr == 1) {
+    c.algorithm = CONV_WINOGRAD;
+    c.execution_mode = 0xa061;
+  } else if (estl::any_of(p.kh, 3, 5, 7) && estl::any_of(p.kw, 3, 5, 7) &&
+             half_or_zero(pt, p.kh) && half_or_zero(pl, p.kw) &&
+             pb <= p.kh / 2 && pr <= p.kw / 2) {
+    c.algorithm = CONV_DIRECT;
+    c.execution_mode = 0xa060;
+  } else {
+    c.algorithm = CONV_DIRECT;
+    c.execution_mode = 0xd060;
+  }
+
+  if (c.setup() != ELD_OK) {
+    el_error("subpixel: phase convolution setup error");
+  }
+}
+
+Template_elx_deconv_subpixel_t
+Instance_elx_deconv_subpixel_t::~elx_deconv_subpixel_t()
+{
+  iter_each (_p, np_) {
+    if (phases_[_p].conv != nullptr)
+      delete phases_[_p].conv;
+  }
+  delete[] phases_;
+  if (workspace_ != nullptr)
+    ::free(workspace_);
+}
+
+// weights: outer, kh, kw, inner => per phase sub-kernel, flipped
+Template_elx_deconv_subpixel_t
+void Instance_elx_deconv_subpixel_t::trans_weights_split(WeightsType *weights)
+{
+  iter_each (_p, np_) {
+    auto &p = phases_[_p];
+    if (p.conv == nullptr) continue;
+    int _ph = _p / this->ws, _pw = _p % this->ws;
+
+    parallel_for<3>(mthr_, [&](int _o, int _kh, int _kw) {
+      MD4(WeightsType, aweights, weights, wouter_, this->kh, this->kw, winner_);
+      MD4(WeightsType, apweights, p.weights, wouter_, p.kh, p.kw, winner_);
+      int _skh = _ph + this->hs * (p.kh - 1 - _kh);
+      int _skw = _pw + this->ws * (p.kw - 1 - _kw);
+      memcpy(&md4(apweights, _o, _kh, _kw, 0), &md4(aweights, _o, _skh, _skw, 0),
+             winner_ * sizeof(WeightsType));
+    }, (int)wouter_, p.kh, p.kw);
+  }
+}
+
+// phase output: _oh, _ow => output: oh0 + hs * _oh, ow0 + ws * _ow
+Template_elx_deconv_subpixel_t
+void Instance_elx_deconv_subpixel_t::interleave_output(
+    OutputType *output, phase_t &p)
+{
+  int nb = this->output_fmt == nChw16c ? this->n * ALIGNUP(this->oc, V) / V
+                                       : this->n;
+  int cs = this->output_fmt == nChw16c ? V : this->oc;
+
+  parallel_for<3>(mthr_, [&](int _b, int _oh, int _ow) {
+    MD4(OutputType, aoutput, output, nb, this->oh, this->ow, cs);
+    MD4(OutputType, apoutput, p.output, nb, p.oh, p.ow, cs);
+    memcpy(&md4(aoutput, _b, p.oh0 + this->hs * _oh, p.ow0 + this->ws * _ow, 0),
+           &md4(apoutput, _b, _oh, _ow, 0), cs * sizeof(OutputType));
+  }, nb, p.oh, p.ow);
+}
+
+Template_elx_deconv_subpixel_t
+void Instance_elx_deconv_subpixel_t::execute(
+    void *output, void *input, void *weights, void *bias)
+{
+  if (is_first_run_)
+    trans_weights_split((WeightsType *)weights);
+  if (inference_acc_)
+    is_first_run_ = false;
+
+  // Interleave each phase while its output is still in cache
+  iter_each (_p, np_) {
+    auto &p = phases_[_p];
+    if (p.conv == nullptr) continue;
+    p.conv->xc->execute(p.output, input, p.weights, bias);
+    interleave_output((OutputType *)output, p);
+  }
+}
+
+} // namespace euler
@@ -0,0 +1,67 @@
+#ifndef __ELX_DECONV_SUBPIXEL_HPP__
+#define __ELX_DECONV_SUBPIXEL_HPP__
+
+#include "euler.hpp"
+#include "el_def.hpp"
+#include "el_utils.hpp"
+#include "elx_conv.hpp"
+
+// Sub-pixel deconvolution.
+//
+// Outputs of a stride-s deconvolution fall into hs * ws phases
+// (ph, pw) = ((oh + tp) % hs, (ow + lp) % ws). Phase (ph, pw) is a stride 1
+// convolution over the flipped sub-kernel w[ph + hs * _kh][pw + ws * _kw],
+// so no multiply-add touches an inserted zero. Each phase runs on an
+// internal direct/Winograd descriptor into a phase buffer, which is then
+// interleaved into the output.
+
+namespace euler {
+
+#define Template_elx_deconv_subpixel_t                                         \
+  template <typename UserTypes, typename TarrayTypes, const int V, const int I>
+
+#define Instance_elx_deconv_subpixel_t                                         \
+  elx_deconv_subpixel_t<UserTypes, TarrayTypes, V, I>
+
+Template_elx_deconv_subpixel_t class elx_deconv_subpixel_t : public elx_conv_t {
+  using InputType = typename UserTypes::InputType;
+  using WeightsType = typename UserTypes::WeightsType;
+  using OutputType = typename UserTypes::OutputType;
+  using BiasType = typename UserTypes::BiasType;
+
+  public:
+  elx_deconv_subpixel_t(eld_conv_t &dc);
+  virtual ~elx_deconv_subpixel_t();
+
+  virtual void execute(void *output, void *input, void *weights, void *bias);
+
+  private:
+  struct phase_t {
+    // sub-kernel, first output and output count along h/w
+    int kh, kw, oh0, ow0, oh, ow;
+    eld_conv_t *conv;
+    WeightsType *weights;
+    OutputType *output;
+  };
+
+  void setup_phase(eld_conv_t &dc, phase_t &p, int _ph, int _pw);
+  void trans_weights_split(WeightsType *weights);
+  void interleave_output(OutputType *output, phase_t &p);
+
+  int np_;
+  phase_t *phases_;
+
+  bool is_first_run_;
+  bool inference_acc_;
+
+  // weights: outer, kh, kw, inner
+  size_t wouter_, winner_;
+  void *workspace_;
+  int mthr_;
+};
+
+// fp32-f32f32f32
+template class elx_deconv_subpixel_t<conv::FP32, conv_impl::FP32, 16, ISA_SKX_AVX512>;
+
+} // namespace euler
+#endif // __ELX_DECONV_SUBPIXEL_HPP__
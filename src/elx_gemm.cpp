@@ -0,0 +1,456 @@
+#include <string.h>
+#include <algorithm>
+#include "el_def.hpp"
+#include "el_utils.hpp"
+#include "el_stl.hpp"
+#include "el_parallel.hpp"
+#include "elx_gemm.hpp"
+
+namespace euler {
+
+static inline size_t elem_size(uint8_t dt)
+{
+  return dt == u8 || dt == s8 ? 1 : dt == f16 ? 2 : 4;
+}
+
+elx_gemm_t::elx_gemm_t(eld_gemm_t &dg)
+{
+  const int V = 16;
+  m = dg.dims.m;
+  n = dg.dims.n;
+  k = dg.dims.k;
+  batch = dg.dims.batch;
+  trans_a = dg.trans.a;
+  trans_b = dg.trans.b;
+  lda = dg.ld.a != 0 ? dg.ld.a : trans_a ? m : k;
+  ldb = dg.ld.b != 0 ? dg.ld.b : trans_b ? k : n;
+  ldc = dg.ld.c != 0 ? dg.ld.c : n;
+  stride_a = dg.batch_stride.a != 0
+      ? dg.batch_stride.a : (size_t)(trans_a ? k : m) * lda;
+  stride_b = dg.batch_stride.b;
+  stride_c = dg.batch_stride.c != 0 ? dg.batch_stride.c : (size_t)m * ldc;
+  a_es = elem_size(dg.data_type.a);
+  b_es = elem_size(dg.data_type.b);
+  c_es = elem_size(dg.data_type.c);
+  with_bias = dg.with_bias;
+  with_sum = dg.with_sum;
+  with_relu = dg.with_relu;
+
+  pa = nullptr;
+  pb = nullptr;
+  b_ready = false;
+  scratch = nullptr;
+
+  // Small GEMMs: a conv setup and parallel region per matrix costs more
+  // than the GEMM
+  bool lp = dg.data_type.a == u8;
+  small = !lp && (stride_b != 0
+      || (batch > 1 && m <= 256 && n <= 256 && k <= 256));
+  if (small) {
+    packed_a = packed_b = per_matrix = false;
+    setup_small(dg);
+    return;
+  }
+
+  // INT8 1x1 takes OIhw16i16o weights only
+  packed_a = trans_a || lda != k || stride_a != (size_t)m * k;
+  packed_b = lp || ldb != (trans_b ? k : n);
+  per_matrix = stride_c != (size_t)m * ldc;
+
+  if (packed_a)
+    MEMALIGN64(&pa, a_es * batch * m * k);
+  if (packed_b)
+    MEMALIGN64(&pb, b_es * ALIGNUP(k, V) * ALIGNUP(n, V));
+
+  conv.data_type.input = dg.data_type.a;
+  conv.data_type.weights = dg.data_type.b;
+  conv.data_type.output = dg.data_type.c;
+  conv.data_type.bias = dg.data_type.bias;
+  conv.dims = {per_matrix ? 1 : batch, 1, k, n, 1, m, 1, m, 1, 1};
+  conv.formats = {nhwc, lp ? OIhw16i16o : trans_b ? oihw : hwio, nhwc};
+  conv.pads = {0, 0, 0, 0};
+  conv.algorithm = CONV_DIRECT_1X1;
+  conv.execution_mode = lp ? 0xc160 : 0xa061;
+  conv.prop_kind = forward_inference;
+  conv.with_bias = dg.with_bias;
+  conv.with_ip_sum = dg.with_sum;
+  conv.with_relu = dg.with_relu;
+  conv.activation = {dg.activation.alg, dg.activation.alpha,
+                     dg.activation.beta};
+  conv.nthreads = dg.nthreads;
+  conv.use_scratch_pad = false;
+  conv.disable_autoparam = true;
+  if (ldc != n)
+    conv.output_view = {ldc, 0, 0, 0, 0, 0};
+  if (lp) {
+    conv.input_quant = {dg.a_quant.scale, dg.a_quant.z};
+    conv.output_quant = {dg.c_quant.scale, dg.c_quant.z};
+    // sum operand of C quantization
+    conv.sum_quant = {1.0f, dg.c_quant.z};
+    conv.sampling_kind = CALIBRATED;
+  }
+  set_blocking(dg, lp);
+
+  if (conv.setup() != ELD_OK)
+    el_error("GEMM: 1x1 conv setup error");
+}
+
+elx_gemm_t::~elx_gemm_t()
+{
+  free(pa);
+  free(pb);
+  free(scratch);
+}
+
+// Register tile of T rows x O vectors, I2 vectors of k per kernel call,
+// ic4 slices of k so that weights of a task (oc3 * O x ic3 * I2 vectors)
+// stay in L2 and K-split tasks cover all threads, oc3 blocks of O per task
+// with tasks for all threads:
+// - tall-skinny (n < 2V): one vector of n, T up to 28 rows
+// - GEMV (m < 8): all rows in a tile, O up to 4 for the register file
+void elx_gemm_t::set_blocking(eld_gemm_t &dg, bool lp)
+{
+  const int V = 16;
+  const size_t L2 = 512 * 1024;
+  const int mthr = omp_get_max_threads();
+  const int ic2 = (k + V - 1) / V, oc2 = (n + V - 1) / V;
+
+  int T, O;
+  if (m < 8) {
+    T = m;
+    O = estl::min(oc2, 4);
+  } else if (oc2 >= 2) {
+    T = estl::min(m, 14);
+    O = 2;
+  } else {
+    T = estl::min(m, 28);
+    O = 1;
+  }
+  // INT8: no O2r tail
+  while (lp && oc2 % O != 0)
+    O /= 2;
+  if (dg.blocking.t != 0) T = dg.blocking.t;
+  if (dg.blocking.o != 0) O = dg.blocking.o;
+
+  int I2 = dg.blocking.i != 0 ? dg.blocking.i : estl::min(ic2, 16);
+  while (ic2 % I2 != 0)
+    --I2;
+  int ic34 = ic2 / I2;
+
+  int oc34 = (oc2 + O - 1) / O;
+  int ntiles = conv.dims.n * ((m + T - 1) / T);
+  int oc4 = estl::min(oc34, (mthr + ntiles - 1) / ntiles);
+  int oc3 = estl::max(1, oc34 / oc4);
+  // oc4 > 1 for n % V == 0 only; INT8: no oc3r tail
+  if (n % V != 0)
+    oc3 = oc34;
+  while (lp && oc34 % oc3 != 0)
+    --oc3;
+
+  // ic4 > 1 for k % V == 0 only; FP32: K-split of ic4 in parallel if
+  // tasks are short of threads (0xa061 nhwc)
+  int ic4 = 1;
+  if (k % V == 0) {
+    int tasks = ntiles * ((oc34 + oc3 - 1) / oc3);
+    int ic4s = lp ? 1 : (mthr + tasks - 1) / tasks;
+    while (ic4 < ic34 && (ic34 % ic4 != 0 || ic4 < ic4s || (size_t)oc3 * O
+           * V * (ic34 / ic4) * I2 * V * b_es > L2))
+      ++ic4;
+  }
+
+  conv.flatting = {O, T};
+  conv.blocking = {I2, 1};
+  conv.partition = {ic4, oc3};
+}
+
+// Rows of op(A), dense m x k per matrix
+void elx_gemm_t::pack_a(char *pa, char *a)
+{
+  const int mthr = omp_get_max_threads();
+  parallel_for<2>(mthr, [&](int _b, int _m) {
+    char *src = a + (_b * stride_a) * a_es;
+    char *dst = pa + ((size_t)_b * m + _m) * k * a_es;
+    if (!trans_a) {
+      memcpy(dst, src + (size_t)_m * lda * a_es, k * a_es);
+    } else if (a_es == 4) {
+      iter_each (_k, k)
+        ((float *)dst)[_k] = ((float *)src)[(size_t)_k * lda + _m];
+    } else {
+      iter_each (_k, k)
+        dst[_k] = src[(size_t)_k * lda + _m];
+    }
+  }, batch, m);
+}
+
+// B of ldb to dense hwio | oihw, or OIhw16i16o for INT8 (k, n of V)
+void elx_gemm_t::pack_b(char *pb, char *b)
+{
+  const int V = 16;
+  const int mthr = omp_get_max_threads();
+  float *src = (float *)b, *dst = (float *)pb;
+  if (conv.formats.weights != OIhw16i16o) {
+    int rows = trans_b ? n : k, cols = trans_b ? k : n;
+    parallel_for<1>(mthr, [&](int _r) {
+      memcpy(&dst[(size_t)_r * cols], &src[(size_t)_r * ldb],
+          cols * sizeof(float));
+    }, rows);
+    return;
+  }
+
+  parallel_for<2>(mthr, [&](int _oc2, int _ic2) {
+    MD4(float, adst, dst, n / V, k / V, V, V);
+    iter_each (_iv, V) {
+    iter_each (_ov, V) {
+      int _oc = _oc2 * V + _ov, _ic = _ic2 * V + _iv;
+      md4(adst, _oc2, _ic2, _iv, _ov) = trans_b
+          ? src[(size_t)_oc * ldb + _ic] : src[(size_t)_ic * ldb + _oc];
+    }}
+  }, n / V, k / V);
+}
+
+// Register tile of T rows x O vectors on the whole k (I2 = ic2, Ir of
+// k tail), T balanced over the rows of m; n blocks grouped for tasks of
+// all threads if the batch is short of threads
+void elx_gemm_t::setup_small(eld_gemm_t &dg)
+{
+  const int V = 16;
+  mthr = omp_get_max_threads();
+  if (dg.nthreads > 0 && dg.nthreads < mthr)
+    mthr = dg.nthreads;
+
+  ic2 = (k + V - 1) / V;
+  int oc2 = (n + V - 1) / V;
+  O = dg.blocking.o != 0 ? dg.blocking.o : estl::min(oc2, 4);
+  T = dg.blocking.t != 0 ? dg.blocking.t : O == 1 ? 28 : 14;
+  if (dg.blocking.t == 0)
+    T = (m + (m + T - 1) / T - 1) / ((m + T - 1) / T);
+  T = estl::min(T, m);
+  O = estl::min(O, oc2);
+  if (O > 8 || T > 32)
+    el_error("GEMM: small GEMM blocking error");
+  mt = (m + T - 1) / T;
+  Tr = m - (mt - 1) * T;
+  nblk = (oc2 + O - 1) / O;
+  O2r = oc2 - (nblk - 1) * O;
+  n4 = estl::min(nblk, (mthr + batch - 1) / batch);
+  nbs = (nblk + n4 - 1) / n4;
+  n4 = (nblk + nbs - 1) / nbs;
+
+  int Os[2] = { O, O2r }, Ts[2] = { T, Tr };
+  iter_each (_o, 2) {
+  iter_each (_t, 2) {
+    ker[_o][_t] = nullptr;
+    gemm_kernel_binder::bind<1, GKF_CCC>(Os[_o], Ts[_t], &ker[_o][_t]);
+    if (ker[_o][_t] == nullptr)
+      el_error("GEMM: small GEMM kernel of O x T unimplemented");
+  }}
+
+  // Kernel params of GKF_CCC: I2, Ir, O1, activation
+  xc.I2 = ic2;
+  xc.Ir = k % V != 0 ? k % V : V;
+  xc.IC = ic2 * V;
+  xc.O = O;
+  xc.O1 = 1;
+  xc.g = 1;
+  xc.oc = n;
+  xc.oc3 = xc.oc4 = 1;
+  xc.oh = xc.ow = 1;
+  xc.ormask = (1u << V) - 1;
+  xc.act_alg = dg.activation.alg;
+  xc.act_alpha = dg.activation.alpha;
+  xc.act_beta = dg.activation.beta;
+  attr = set_attr(0x0, r_output_idx);
+  if (k % V != 0)
+    attr = set_attr(attr, has_Ir_idx);
+
+  // B panel: a row of k more for the weights preload of the kernel
+  bp_size = (size_t)(ic2 + 1) * V * nbs * O * V;
+  ap_size = (size_t)ic2 * V * T;
+  op_size = (size_t)O * T * V;
+  MEMALIGN64(&scratch, sizeof(float) * mthr * (bp_size + ap_size + op_size));
+  bkey.resize(mthr);
+}
+
+// A tile of rows [m0, m0 + tt) of op(A) to [I2][tt][V]
+void elx_gemm_t::pack_a_tile(float *ap, float *a, int m0, int tt)
+{
+  const int V = 16;
+  MD3(float, aap, ap, ic2, tt, V);
+  if (!trans_a) {
+    iter_each (_t, tt) {
+      float *src = &a[(size_t)(m0 + _t) * lda];
+      iter_each (_I2, ic2) {
+        int kv = estl::min(V, k - _I2 * V);
+        __mmask16 km = _cvtu32_mask16((1u << kv) - 1);
+        _mm<V>::store_ps(&md3(aap, _I2, _t, 0),
+            _mm512_maskz_loadu_ps(km, &src[_I2 * V]));
+      }
+    }
+  } else {
+    iter_each (_k, k) {
+      float *src = &a[(size_t)_k * lda + m0];
+      iter_each (_t, tt)
+        md3(aap, _k / V, _t, _k % V) = src[_t];
+    }
+  }
+}
+
+// n blocks [nb0, nb1) of op(B) to [block][I2][V][ob][V], ob of the block
+void elx_gemm_t::pack_b_panel(float *bp, float *b, int nb0, int nb1)
+{
+  const int V = 16;
+  for (int _nb = nb0; _nb < nb1; ++_nb) {
+    int ob = _nb < nblk - 1 ? O : O2r;
+    float *dst = &bp[(size_t)(_nb - nb0) * ic2 * V * O * V];
+    MD3(float, abp, dst, ic2 * V, ob, V);
+    iter_each (_o, ob) {
+      int n0 = (_nb * O + _o) * V;
+      int nv = estl::min(V, n - n0);
+      if (!trans_b) {
+        __mmask16 km = _cvtu32_mask16((1u << nv) - 1);
+        iter_each (_k, k)
+          _mm<V>::store_ps(&md3(abp, _k, _o, 0),
+              _mm512_maskz_loadu_ps(km, &b[(size_t)_k * ldb + n0]));
+      } else {
+        iter_each (_v, V) {
+          float *src = &b[(size_t)(n0 + _v) * ldb];
+          iter_each (_k, k)
+            md3(abp, _k, _o, _v) = _v < nv ? src[_k] : 0.0f;
+        }
+      }
+    }
+  }
+}
+
+// C tile [ob][tt][V] to rows [m0, m0 + tt) of block _nb: bias, sum of C,
+// activation
+void elx_gemm_t::unpack_c_tile(float *c, float *op, float *bias, int m0,
+    int tt, int _nb, int ob)
+{
+  const int V = 16;
+  MD3(float, aop, op, ob, tt, V);
+  iter_each (_o, ob) {
+    int n0 = (_nb * O + _o) * V;
+    int nv = estl::min(V, n - n0);
+    __mmask16 km = _cvtu32_mask16((1u << nv) - 1);
+    __m<V> mmbias = with_bias
+        ? _mm512_maskz_loadu_ps(km, &bias[n0]) : _mm<V>::setzero_ps();
+    iter_each (_t, tt) {
+      float *dst = &c[(size_t)(m0 + _t) * ldc + n0];
+      __m<V> x = _mm<V>::load_ps(&md3(aop, _o, _t, 0)) + mmbias;
+      if (with_sum)
+        x = x + _mm512_maskz_loadu_ps(km, dst);
+      if (with_relu)
+        x = xc.activate<V>(x);
+      _mm512_mask_storeu_ps(dst, km, x);
+    }
+  }
+}
+
+void elx_gemm_t::execute_small(char **c, char **a, char **b, char *c0,
+    char *a0, char *b0, float *bias)
+{
+  const int V = 16;
+  auto matrix = [](char **x, char *x0, size_t stride, int _b) {
+    return (float *)(x != nullptr ? x[_b] : x0 + _b * stride * sizeof(float));
+  };
+
+  std::fill(bkey.begin(), bkey.end(), nullptr);
+  parallel_for<2>(mthr, [&](int _b, int _n4) {
+    size_t ithr = omp_get_thread_num();
+    float *bp = &scratch[ithr * (bp_size + ap_size + op_size)];
+    float *ap = bp + bp_size, *op = ap + ap_size;
+    float *_a = matrix(a, a0, stride_a, _b);
+    float *_w = matrix(b, b0, stride_b, _b);
+    float *_c = matrix(c, c0, stride_c, _b);
+
+    // B panel of the group, packed once for consecutive tasks of shared B
+    int nb0 = _n4 * nbs, nb1 = estl::min(nblk, nb0 + nbs);
+    float *key = trans_b ? &_w[(size_t)nb0 * O * V * ldb]
+                         : &_w[(size_t)nb0 * O * V];
+    if (bkey[ithr] != key) {
+      pack_b_panel(bp, _w, nb0, nb1);
+      bkey[ithr] = key;
+    }
+
+    iter_each (_mt, mt) {
+      int m0 = _mt * T, tt = _mt < mt - 1 ? T : Tr;
+      pack_a_tile(ap, _a, m0, tt);
+      for (int _nb = nb0; _nb < nb1; ++_nb) {
+        int ob = _nb < nblk - 1 ? O : O2r;
+        ker[ob != O][tt != T](xc, op, ap,
+            &bp[(size_t)(_nb - nb0) * ic2 * V * O * V], nullptr, attr);
+        unpack_c_tile(_c, op, bias, m0, tt, _nb, ob);
+      }
+    }
+  }, batch, n4);
+}
+
+void elx_gemm_t::execute(void *c, void *a, void *b, void *bias)
+{
+  if (small) {
+    execute_small(nullptr, nullptr, nullptr, (char *)c, (char *)a,
+        (char *)b, (float *)bias);
+    return;
+  }
+
+  if (packed_a) {
+    pack_a(pa, (char *)a);
+    a = pa;
+  }
+  // B is transformed by the conv at first run only
+  if (packed_b) {
+    if (!b_ready)
+      pack_b(pb, (char *)b);
+    b_ready = true;
+    b = pb;
+  }
+
+  if (!per_matrix) {
+    if (elx_conv(conv, c, a, b, bias) != ELX_OK)
+      el_error("GEMM: 1x1 conv execution error");
+    return;
+  }
+  iter_each (_b, batch) {
+    char *_c = (char *)c + _b * stride_c * c_es;
+    char *_a = (char *)a + (size_t)_b * m * k * a_es;
+    if (elx_conv(conv, _c, _a, b, bias) != ELX_OK)
+      el_error("GEMM: 1x1 conv execution error");
+  }
+}
+
+int elx_gemm(eld_gemm_t &desc, void *c, void *a, void *b, void *bias)
+{
+  if (desc.xg == nullptr || c == nullptr || a == nullptr || b == nullptr
+      || (desc.with_bias && bias == nullptr)) {
+    el_error("GEMM: parameter error");
+    return ELX_GENERAL_ERROR;
+  }
+  desc.xg->execute(c, a, b, bias);
+  return ELX_OK;
+}
+
+int elx_gemm_batch(eld_gemm_t &desc, void **c, void **a, void **b,
+    void *bias)
+{
+  if (desc.xg == nullptr || c == nullptr || a == nullptr || b == nullptr
+      || (desc.with_bias && bias == nullptr)) {
+    el_error("GEMM: parameter error");
+    return ELX_GENERAL_ERROR;
+  }
+  if (!desc.xg->small) {
+    el_error("GEMM: batch of pointers on small GEMMs only");
+    return ELX_UNIMPLEMENTED;
+  }
+  desc.xg->execute_small((char **)c, (char **)a, (char **)b, nullptr,
+      nullptr, nullptr, (float *)bias);
+  return ELX_OK;
+}
+
+int elx_ip(eld_ip_t &desc, void *output, void *input, void *weights,
+    void *bias)
+{
+  return elx_gemm(desc.gemm, output, input, weights, bias);
+}
+
+}  // namespace euler
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <vector>
+#include "euler.hpp"
+#include "elx_conv.hpp"
+#include "kernel/elk_gemm_otj_binder.hxx"
+
+namespace euler {
+
+// GEMM of a batch as the 1x1 conv of nhwc input (A, m pixels of k
+// channels), hwio | oihw weights (B) and nhwc output (C, m pixels of n
+// channels): batch x 1 x m images, 0xa061 (FP32) | 0xc160 (INT8)
+//
+// Small GEMMs (FP32): tasks of (matrix, group of n blocks) in one
+// parallel region; per thread, B of the group packed to a compact panel
+// [n block][I2][V][O][V], A to a tile [I2][T][V] per T rows, GKF_CCC
+// kernel on the whole k to a tile [O][T][V], then bias, sum, activation
+// on the copy to C
+struct elx_gemm_t {
+  elx_gemm_t(eld_gemm_t &dg);
+  ~elx_gemm_t();
+  void execute(void *c, void *a, void *b, void *bias);
+  // Matrices at c[i], a[i], b[i] | strided from c0, a0, b0 if null
+  void execute_small(char **c, char **a, char **b, char *c0, char *a0,
+      char *b0, float *bias);
+
+  // Conv blocking by shape: register tile, k blocking and oc partition
+  void set_blocking(eld_gemm_t &dg, bool lp);
+  // op(A) of the batch to dense m x k matrices, B to dense k x n | n x k
+  void pack_a(char *pa, char *a);
+  void pack_b(char *pb, char *b);
+
+  // Small GEMM: tile, n groups, kernels and scratch by shape
+  void setup_small(eld_gemm_t &dg);
+  void pack_a_tile(float *ap, float *a, int m0, int tt);
+  void pack_b_panel(float *bp, float *b, int nb0, int nb1);
+  void unpack_c_tile(float *c, float *op, float *bias, int m0, int tt,
+      int _nb, int ob);
+
+  int m, n, k, batch;
+  bool trans_a, trans_b;
+  int lda, ldb, ldc;
+  size_t stride_a, stride_b, stride_c;
+  size_t a_es, b_es, c_es;
+  bool with_bias, with_sum, with_relu;
+
+  // A/B are packed before the conv; conv per matrix of the batch if C of
+  // the batch is not of the nhwc tensor
+  bool packed_a, packed_b, per_matrix;
+  char *pa, *pb;
+  bool b_ready;
+
+  eld_conv_t conv;
+
+  // Small GEMM: T x O register tile, Tr/O2r of the last, mt tiles of m,
+  // nblk blocks of O vectors of n, nbs blocks per task in n4 groups
+  bool small;
+  int mthr, ic2, T, Tr, O, O2r, mt, nblk, nbs, n4, attr;
+  gemm_kernel_binder::kgemm<conv_impl::FP32> *ker[2][2];
+  elx_conv_params_t xc;
+  // Per thread B panel, A tile, C tile; B panel packed by the thread
+  size_t bp_size, ap_size, op_size;
+  float *scratch;
+  std::vector<float *> bkey;
+};
+
+}  // namespace euler
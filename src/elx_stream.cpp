@@ -53,12 +53,7 @@ int elx_stream::run() {
   mlock.unlock();
 
   if (xc != nullptr) {
-    if (xc->verbose) {
-      xc->timed_execute(xc->output_ptr, xc->input_ptr, xc->weights_ptr,
-                        xc->bias_ptr);
-    } else {
-      xc->execute(xc->output_ptr, xc->input_ptr, xc->weights_ptr, xc->bias_ptr);
-    }
+    xc->run(xc->output_ptr, xc->input_ptr, xc->weights_ptr, xc->bias_ptr);
 
     if (xc->stream_sync) {
       xc->mu.unlock();
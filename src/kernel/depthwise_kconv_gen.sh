@@ -0,0 +1,58 @@
+#!/bin/bash
+
+# Build depthwise conv kernel instantiation
+#
+
+src_file=$1; dst_dir=$2; cc=$3; enable_user_fp16=$4
+
+if [ ! -f $src_file ] || [ ! -d $dst_dir ]; then
+  "Invalid src_file=$src_file or dst_dir=$dst_dir"
+  exit -1
+fi
+
+__depthwise_kconv_generate_inst__() {
+  ktype=$1; dtype=$2; V=$3; I=$4; S=$5; F=$6;
+
+  cat <<@ > $dst_dir/elk_${ktype}_otj_${dtype}_${V}_${I}_${S}_${F}.cpp
+// _generated_kernel_file_
+//
+#include "$src_file"
+
+using namespace euler;
+
+namespace euler {
+
+#undef E
+#define E(T, K) \\
+  ${ktype}_kernel_binder::conv_ker_cls<conv_impl::$dtype, \\
+      $V, $I, $S, $F, T, K>::conv
+  ${ktype}_kernel_binder::kconv<conv_impl::$dtype>
+      *${ktype}_kernel_binder::kconv_${dtype}_${V}_${I}_${S}_${F}[16][5] =
+  { // 16
+      { E(1, 3), E(1, 4), E(1, 5), E(1, 6), E(1, 7) },
+      { E(2, 3), E(2, 4), E(2, 5), E(2, 6), E(2, 7) },
+      { E(3, 3), E(3, 4), E(3, 5), E(3, 6), E(3, 7) },
+      { E(4, 3), E(4, 4), E(4, 5), E(4, 6), E(4, 7) },
+      { E(5, 3), E(5, 4), E(5, 5), E(5, 6), E(5, 7) },
+      { E(6, 3), E(6, 4), E(6, 5), E(6, 6), E(6, 7) },
+      { E(7, 3), E(7, 4), E(7, 5), E(7, 6), E(7, 7) },
+      { E(8, 3), E(8, 4), E(8, 5), E(8, 6), E(8, 7) },
+      { E(9, 3), E(9, 4), E(9, 5), E(9, 6), E(9, 7) },
+      { E(10, 3), E(10, 4), E(10, 5), E(10, 6), E(10, 7) },
+      { E(11, 3), E(11, 4), E(11, 5), E(11, 6), E(11, 7) },
+      { E(12, 3), E(12, 4), E(12, 5), E(12, 6), E(12, 7) },
+      { E(13, 3), E(13, 4), E(13, 5), E(13, 6), E(13, 7) },
+      { E(14, 3), E(14, 4), E(14, 5), E(14, 6), E(14, 7) },
+      { E(15, 3), E(15, 4), E(15, 5), E(15, 6), E(15, 7) },
+      { E(16, 3), E(16, 4), E(16, 5), E(16, 6), E(16, 7) },
+  };
+
+} // namespace
+@
+}
+
+if [ $enable_user_fp16 == "ON" ]; then
+  eval $($cc -DENABLE_USER_FP16 -DBUILD_OTJ_TBL -E $src_file 2>&1 | grep _generate_inst_)
+else
+  eval $($cc -DBUILD_OTJ_TBL -E $src_file 2>&1 | grep _generate_inst_)
+fi
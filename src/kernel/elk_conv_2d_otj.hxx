@@ -0,0 +1,219 @@
+#pragma once
+
+#include "el_intrin.hpp"
+#include "el_utils.hpp"
+#include "el_stl.hpp"
+#include "elx_conv.hpp"
+#include "elk_gemm_traits.hxx"
+
+// S: stride
+// F: format
+// O: OC blocking unit
+// H: output rows
+// T: tile blocking unit
+// V: vector size
+// I: ISA
+
+namespace euler {
+
+// Direct conv kernel with 2-D (H x T) register blocking: H output rows of
+// T pixels share each weights load, and the kh input rows of a row are
+// reused by the next H - 1 rows while still in L1. Kernel size, padding
+// and dilation are runtime.
+template <typename GarrayTypes, int V, int I, typename KP>
+struct conv_2d_kernel_otj {
+  static inline void conv(
+      elx_conv_params_t &,
+      typename GarrayTypes::OutputType *,
+      typename GarrayTypes::InputType *,
+      typename GarrayTypes::WeightsType *,
+      typename GarrayTypes::BiasType *,
+      int, int, bool, int) {}
+};
+
+template <typename GarrayTypes, int V, int ...Kp>
+struct conv_2d_kernel_otj<GarrayTypes, V, ISA_SKX_AVX512,
+    estl::integer_sequence<Kp...>> {
+  using kparams = estl::integer_sequence<Kp...>;
+  static_assert(sizeof...(Kp) == 5,
+      "Kernel parameters must be GarrayTypes, V, I, <S, F, O, H, T>");
+
+  using InputType = typename GarrayTypes::InputType;
+  using WeightsType = typename GarrayTypes::WeightsType;
+  using OutputType = typename GarrayTypes::OutputType;
+  using BiasType = typename GarrayTypes::BiasType;
+
+  constexpr static auto S = estl::get<0, int, kparams>();
+  constexpr static auto F = estl::get<1, int, kparams>();
+  constexpr static auto O = estl::get<2, int, kparams>();
+  constexpr static auto H = estl::get<3, int, kparams>();
+  constexpr static auto T = estl::get<4, int, kparams>();
+
+  static_assert(F_traits<F>::is_compact_weights,
+      "2-D conv kernel: compact weights only");
+  static_assert(F_traits<F>::is_nhwc_input == F_traits<F>::is_nhwc_output,
+      "2-D conv kernel: input and output of same format");
+
+  // output: oc-block (_O1, _O), row _H, column _T of the tile
+  static inline OutputType *op_output(
+      elx_conv_params_t &xc, OutputType *output, int _O1, int _O, int _H, int _T)
+  {
+    if (F_traits<F>::is_nhwc_output) {
+      MD3(OutputType, aoutput, output, H, xc.ow, xc.oc);
+      return &md3(aoutput, _H, _T, (_O1 * O + _O) * V);
+    } else {
+      MD4(OutputType, aoutput, output, xc.O1 * O, xc.oh, xc.ow, V);
+      return &md4(aoutput, _O1 * O + _O, _H, _T, 0);
+    }
+  }
+
+  static inline __m<V> op_load_input(elx_conv_params_t &xc,
+      InputType *input, int _ih, int _iw, int _I2, int _V)
+  {
+    if (F_traits<F>::is_nhwc_input) {
+      MD3(InputType, ainput, input, xc.ih, xc.iw, xc.ic);
+      return _mm<V>::set1_ps(md3(ainput, _ih, _iw, _I2 * V + _V));
+    } else {
+      MD4(InputType, ainput, input, xc.I2, xc.ih, xc.iw, V);
+      return _mm<V>::set1_ps(md4(ainput, _I2, _ih, _iw, _V));
+    }
+  }
+
+  static inline __m<V> op_load_weights(elx_conv_params_t &xc,
+      WeightsType *weights, int _kh, int _kw, int _O1, int _I2, int _V, int _O)
+  {
+    MD7(WeightsType, aweights, weights, xc.kh, xc.kw, xc.O1, xc.I2, V, O, V);
+    if (std::is_same<WeightsType, float>::value) {
+      return _mm<V>::load_ps(&md7(aweights, _kh, _kw, _O1, _I2, _V, _O, 0));
+    } else if (O == 2) { // bf16 type weights
+      return (_O == 0)
+          ? _mm<V>::load_ps(&md7(aweights, _kh, _kw, _O1, _I2, _V, 0, 0))
+          : _mm<V>::loadu_ps(&md7(aweights, _kh, _kw, _O1, _I2, _V, 0, 0) - 1);
+    } else {            // fp16 type weights
+      auto fp16v = _mm<V / 2>::load_si256(
+          (__m256i *)&md7(aweights, _kh, _kw, _O1, _I2, _V, _O, 0));
+      return _mm<V>::cvtph_ps(fp16v);
+    }
+  }
+
+  // (_ih, _iw): input of (_H = 0, _T = 0, _kh = 0, _kw = 0), may be in
+  // padding. border: some input rows/columns of the tile are in padding.
+  template <bool border>
+  static inline void op_conv(elx_conv_params_t &xc, OutputType *output,
+      InputType *input, WeightsType *weights, BiasType *bias,
+      int _O1, int _ih, int _iw, int attr)
+  {
+    __m<V> mmout[O][H][T];
+    __mmask16 k = _cvtu32_mask16(xc.ormask);
+    const bool has_Or = F_traits<F>::is_nhwc_output
+        && get_attr(attr, has_Or_idx) && _O1 == xc.O1 - 1;
+    MD3(BiasType, abias, bias, xc.O1, O, V);
+
+    // nhwc output: unaligned, tail OC masked
+    auto load_out = [&](int _O, int _H, int _T) {
+      auto aout = op_output(xc, output, _O1, _O, _H, _T);
+      if (has_Or && _O == O - 1)
+        return _mm512_maskz_loadu_ps(k, aout);
+      return F_traits<F>::is_nhwc_output ? _mm<V>::loadu_ps(aout)
+                                         : _mm<V>::load_ps(aout);
+    };
+
+    if (get_attr(attr, r_output_idx)) {
+      unroll_for (_O, O) {
+        __m<V> b = _mm<V>::setzero_ps();
+        if (get_attr(attr, bias_idx))
+          b = has_Or && _O == O - 1
+              ? _mm512_maskz_loadu_ps(k, &md3(abias, _O1, _O, 0))
+              : _mm<V>::load_ps(&md3(abias, _O1, _O, 0));
+        unroll_for (_H, H)
+          unroll_for (_T, T)
+            mmout[_O][_H][_T] = b;
+      }
+      if (get_attr(attr, ip_sum_idx)) {
+        unroll_for (_O, O)
+          unroll_for (_H, H)
+            unroll_for (_T, T)
+              mmout[_O][_H][_T] += load_out(_O, _H, _T);
+      }
+    } else {
+      unroll_for (_O, O)
+        unroll_for (_H, H)
+          unroll_for (_T, T)
+            mmout[_O][_H][_T] = load_out(_O, _H, _T);
+    }
+
+    int I2 = xc.I2, Ir = V;
+    if (get_attr(attr, has_Ir_idx))
+      Ir = xc.Ir;
+
+    for (int _kh = 0; _kh < xc.kh; ++_kh) {
+      int __ih = _ih + _kh * xc.hd;
+      bool rv[H];
+      unroll_for (_H, H)
+        rv[_H] = !border
+            || (__ih + _H * xc.hs >= 0 && __ih + _H * xc.hs < xc.ih);
+      for (int _kw = 0; _kw < xc.kw; ++_kw) {
+        int __iw = _iw + _kw * xc.wd;
+        for (int _I2 = 0; _I2 < I2; ++_I2) {
+          int V_ = _I2 == I2 - 1 ? Ir : V;
+#pragma nounroll
+          for (int _V = 0; _V < V_; ++_V) {
+            __m<V> mmwei[O];
+            unroll_for (_O, O)
+              mmwei[_O] = op_load_weights(xc, weights, _kh, _kw, _O1, _I2, _V, _O);
+            unroll_for (_H, H) {
+              if (border && !rv[_H]) continue;
+              unroll_for (_T, T) {
+                if (border && (__iw + _T * S < 0 || __iw + _T * S >= xc.iw))
+                  continue;
+                __m<V> mmbcst = op_load_input(xc, input,
+                    __ih + _H * xc.hs, __iw + _T * S, _I2, _V);
+                unroll_for (_O, O)
+                  mmout[_O][_H][_T] = _mm<V>::fmadd_ps(
+                      mmwei[_O], mmbcst, mmout[_O][_H][_T]);
+              }
+            }
+          }
+        }
+      }
+    }
+
+    if (get_attr(attr, relu_idx)) {
+      unroll_for (_O, O)
+        unroll_for (_H, H)
+          unroll_for (_T, T)
+            mmout[_O][_H][_T] = xc.activate<V>(mmout[_O][_H][_T]);
+    }
+    unroll_for (_O, O) {
+      unroll_for (_H, H) {
+        unroll_for (_T, T) {
+          auto aout = op_output(xc, output, _O1, _O, _H, _T);
+          if (has_Or && _O == O - 1)
+            _mm512_mask_storeu_ps(aout, k, mmout[_O][_H][_T]);
+          else if (F_traits<F>::is_nhwc_output)
+            _mm512_storeu_ps(aout, mmout[_O][_H][_T]);
+          else
+            _mm<V>::store_ps(aout, mmout[_O][_H][_T]);
+        }
+      }
+    }
+  }
+
+  // output: (row 0, column 0) of the tile, oc-block start
+  // input: (0, 0) of the ic-block
+  // weights: kh, kw, O1, I2, V, O, V (compact)
+  // bias: O1, O, V
+  static inline void conv(elx_conv_params_t &xc, OutputType *output,
+      InputType *input, WeightsType *weights, BiasType *bias,
+      int _ih, int _iw, bool border, int attr)
+  {
+    for (int _O1 = 0; _O1 < xc.O1; ++_O1) {
+      if (border)
+        op_conv<true>(xc, output, input, weights, bias, _O1, _ih, _iw, attr);
+      else
+        op_conv<false>(xc, output, input, weights, bias, _O1, _ih, _iw, attr);
+    }
+  }
+};
+
+} // namespace euler
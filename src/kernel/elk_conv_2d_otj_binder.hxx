@@ -0,0 +1,75 @@
+#pragma once
+
+#if !defined(BUILD_OTJ_TBL)
+#define DECL_KCONV_2D_TBL(type, V, I, S, F)                                    \
+  static kconv<conv_impl::type>                                                \
+      *kconv_##type##_##V##_##I##_##S##_##F[2][4][14]
+#else
+#define DECL_KCONV_2D_TBL(type, V, I, S, F)                                    \
+  __kconv_2d_generate_inst__ conv_2d type V I S F
+#endif
+
+#define LOOKUP_KCONV_2D_TBL(type, V, I, S, F, O, H, T)                         \
+  kconv_##type##_##V##_##I##_##S##_##F[O - 1][H - 1][T - 1]
+
+#if !defined(BUILD_OTJ_TBL)
+#include "el_def.hpp"
+#include "src/kernel/elk_def.hpp"
+#include "src/kernel/elk_conv_2d_otj.hxx"
+
+namespace euler {
+
+struct conv_2d_kernel_binder {
+  template <typename GarrayTypes, int V, int I, int... Kp>
+  using conv_ker_cls = typename euler::conv_2d_kernel_otj<
+      GarrayTypes, V, I, estl::integer_sequence<Kp...>>;
+
+  template <typename GarrayTypes>
+  using kconv = decltype(conv_ker_cls<GarrayTypes, 1, 1, 1, 1, 1, 1, 1>::conv);
+
+#endif // BUILD_OTJ_TBL
+
+  DECL_KCONV_2D_TBL(FP32, 16, ISA_SKX_AVX512, 1, GKF_DCD); // blocked
+  DECL_KCONV_2D_TBL(FP32, 16, ISA_SKX_AVX512, 2, GKF_DCD);
+  DECL_KCONV_2D_TBL(FP32, 16, ISA_SKX_AVX512, 1, GKF_FCF); // nhwc
+  DECL_KCONV_2D_TBL(FP32, 16, ISA_SKX_AVX512, 2, GKF_FCF);
+  DECL_KCONV_2D_TBL(FP32_F16w, 16, ISA_SKX_AVX512, 1, GKF_DCD); // f16c
+  DECL_KCONV_2D_TBL(FP32_F16w, 16, ISA_SKX_AVX512, 2, GKF_DCD);
+  DECL_KCONV_2D_TBL(FP32_F16w, 16, ISA_SKX_AVX512, 1, GKF_FCF);
+  DECL_KCONV_2D_TBL(FP32_F16w, 16, ISA_SKX_AVX512, 2, GKF_FCF);
+
+#if !defined(BUILD_OTJ_TBL)
+
+#  define DEF_CONV_2D_BIND(type)                                            \
+    template <int S, int F>                                                 \
+    static inline void bind(                                                \
+        int O, int H, int T, kconv<conv_impl::type> **func) {               \
+      switch (F) {                                                          \
+      case GKF_DCD:                                                         \
+        if (S == 1)                                                         \
+          *func = LOOKUP_KCONV_2D_TBL(                                      \
+              type, 16, ISA_SKX_AVX512, 1, GKF_DCD, O, H, T);               \
+        else if (S == 2)                                                    \
+          *func = LOOKUP_KCONV_2D_TBL(                                      \
+              type, 16, ISA_SKX_AVX512, 2, GKF_DCD, O, H, T);               \
+        break;                                                              \
+      case GKF_FCF:                                                         \
+        if (S == 1)                                                         \
+          *func = LOOKUP_KCONV_2D_TBL(                                      \
+              type, 16, ISA_SKX_AVX512, 1, GKF_FCF, O, H, T);               \
+        else if (S == 2)                                                    \
+          *func = LOOKUP_KCONV_2D_TBL(                                      \
+              type, 16, ISA_SKX_AVX512, 2, GKF_FCF, O, H, T);               \
+        break;                                                              \
+      default:                                                              \
+        el_error("Unimlemented conv kernel format");                        \
+        break;                                                              \
+      }                                                                     \
+    }
+
+  DEF_CONV_2D_BIND(FP32)
+  DEF_CONV_2D_BIND(FP32_F16w)
+#endif // BUILD_OTJ_TBL
+};
+
+} // namespace euler
@@ -27,12 +27,9 @@ struct elk_conv_wino_trans_input<float, InputType, format, is_border,
     // Outputs
     __m<V> t00, t01, t02, t03, t10, t11, t12, t13, t20, t21, t22, t23, t30, t31,
         t32, t33;
-    // __m<V> mS, mz;
-
-    // if (std::is_same<InputType, uint8_t>::value) {
-    //   mS = _mm<V>::set1_ps(xc.input_quant_S);
-    //   mz = _mm<V>::set1_ps(xc.input_quant_z);
-    // }
+    // u8 input is padded with its zero point
+    __m<V> mpad = std::is_same<InputType, uint8_t>::value
+        ? _mm<V>::set1_ps(xc.input_quant_z) : _mm<V>::setzero_ps();
 
 #undef ldr_f32_impl
 #undef ldr_f16_impl
@@ -54,7 +51,6 @@ struct elk_conv_wino_trans_input<float, InputType, format, is_border,
     __i<V> isrcu8 = _mm512_cvtepu8_epi32(*(__m128i *)addr); \
     __m<V> msrcu8 = _mm512_cvt_roundepi32_ps(isrcu8, \
         _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); \
-    /*(msrcu8 - mz) * mS;*/ \
     (msrcu8); \
   })
 
@@ -72,7 +68,7 @@ struct elk_conv_wino_trans_input<float, InputType, format, is_border,
       MD3(InputType, ainput, input, xc.ih, xc.iw, V);
       if (is_border
           && (_h < hA_start || _w < wA_start || _h > hA_end || _w > wA_end)) {
-        return _mm<V>::setzero_ps();
+        return mpad;
       } else if (std::is_same<InputType, float>::value) {
         return ldr_f32_impl(&md3(ainput, _h, _w, 0));
       } else if (std::is_same<InputType, uint8_t>::value) {
@@ -87,7 +83,7 @@ struct elk_conv_wino_trans_input<float, InputType, format, is_border,
           xc.ic4 * xc.ic3 * xc.I2, V);
       if (is_border
           && (_h < hA_start || _w < wA_start || _h > hA_end || _w > wA_end)) {
-        return _mm<V>::setzero_ps();
+        return mpad;
       } else if (std::is_same<InputType, float>::value) {
         return ldr_f32_impl(&md2(ainput1, 0, 0));
       } else if (std::is_same<InputType, uint8_t>::value) {
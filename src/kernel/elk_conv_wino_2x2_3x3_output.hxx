@@ -20,7 +20,8 @@ struct elk_conv_wino_trans_output<float, OutputType, BiasType, format,
   {
     ENABLE_AVX512F();
 
-    __m<V> z = XOR(z, z);
+    constexpr bool quantized = std::is_same<OutputType, uint8_t>::value
+        || std::is_same<OutputType, int8_t>::value;
     __m<V> mrepS, mzp;
 
     MD3(float, atoutput, toutput, A, A, V);
@@ -124,10 +125,10 @@ struct elk_conv_wino_trans_output<float, OutputType, BiasType, format,
       }
     }
     if (fuse_relu) {
-      p00 = MAX(p00, z);
-      p10 = MAX(p10, z);
-      p01 = MAX(p01, z);
-      p11 = MAX(p11, z);
+      p00 = xc.activate<V, quantized>(p00);
+      p10 = xc.activate<V, quantized>(p10);
+      p01 = xc.activate<V, quantized>(p01);
+      p11 = xc.activate<V, quantized>(p11);
     }
 
 #undef OP
@@ -16,12 +16,9 @@ struct elk_conv_wino_trans_input<float, InputType, format, is_border,
       InputType *input, int hA_start, int hA_end, int wA_start, int wA_end) {
 
     MD3(float, atinput, tinput, A, A, V);
-    // __m<V> mS, mz;
-
-    // if (std::is_same<InputType, uint8_t>::value) {
-    //   mS = _mm<V>::set1_ps(xc.input_quant_S);
-    //   mz = _mm<V>::set1_ps(xc.input_quant_z);
-    // }
+    // u8 input is padded with its zero point
+    __m<V> mpad = std::is_same<InputType, uint8_t>::value
+        ? _mm<V>::set1_ps(xc.input_quant_z) : _mm<V>::setzero_ps();
 
 #undef ldr_f32_impl
 #undef ldr_f16_impl
@@ -43,7 +40,6 @@ struct elk_conv_wino_trans_input<float, InputType, format, is_border,
     __i<V> isrcu8 = _mm512_cvtepu8_epi32(*(__m128i *)addr); \
     __m<V> msrcu8 = _mm512_cvt_roundepi32_ps(isrcu8, \
         _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); \
-    /*(msrcu8 - mz) * mS;*/ \
     (msrcu8); \
   })
 
@@ -61,7 +57,7 @@ struct elk_conv_wino_trans_input<float, InputType, format, is_border,
         MD3(InputType, ainput, input, xc.ih, xc.iw, V);
         if (is_border
             && (_h < hA_start || _w < wA_start || _h > hA_end || _w > wA_end)) {
-          return _mm<V>::setzero_ps();
+          return mpad;
         } else if (std::is_same<InputType, float>::value) {
           return ldr_f32_impl(&md3(ainput, _h, _w, 0));
         } else if (std::is_same<InputType, uint8_t>::value) {
@@ -76,7 +72,7 @@ struct elk_conv_wino_trans_input<float, InputType, format, is_border,
             xc.ic4 * xc.ic3 * xc.I2, V);
         if (is_border
             && (_h < hA_start || _w < wA_start || _h > hA_end || _w > wA_end)) {
-          return _mm<V>::setzero_ps();
+          return mpad;
         } else if (std::is_same<InputType, float>::value) {
           return ldr_f32_impl(&md2(ainput1, 0, 0));
         } else if (std::is_same<InputType, uint8_t>::value) {
@@ -104,7 +104,8 @@ struct elk_conv_wino_trans_output<float, OutputType, BiasType, format,
     auto z0 = _mm<V>::set1_ps(0.3333333333333333f);
     auto z1 = _mm<V>::set1_ps(0.6666666666666666f);
     auto z2 = _mm<V>::set1_ps(1.3333333333333333f);
-    __m<V> z = XOR(z, z);
+    constexpr bool quantized = std::is_same<OutputType, uint8_t>::value
+        || std::is_same<OutputType, int8_t>::value;
 
 #pragma unroll
     for (int i = 0; i < 5; i++) {
@@ -164,9 +165,9 @@ struct elk_conv_wino_trans_output<float, OutputType, BiasType, format,
         }
       }
       if (fuse_relu) {
-        p0 = MAX(p0, z);
-        p1 = MAX(p1, z);
-        p2 = MAX(p2, z);
+        p0 = xc.activate<V, quantized>(p0);
+        p1 = xc.activate<V, quantized>(p1);
+        p2 = xc.activate<V, quantized>(p2);
       }
       STORE(i, 0)
       STORE(i, 1)
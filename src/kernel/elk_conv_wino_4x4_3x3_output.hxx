@@ -125,7 +125,8 @@ struct elk_conv_wino_trans_output<float,OutputType, BiasType, format,
     __m<V> z3 = _mm<V>::set1_ps(0.625f);
     __m<V> z4 = _mm<V>::set1_ps(0.390625f);
     __m<V> z5 = _mm<V>::set1_ps(0.244140625f);
-    __m<V> z = XOR(z, z);
+    constexpr bool quantized = std::is_same<OutputType, uint8_t>::value
+        || std::is_same<OutputType, int8_t>::value;
 
 #pragma unroll
     for (int i = 0; i < 6; i++) {
@@ -195,10 +196,10 @@ struct elk_conv_wino_trans_output<float,OutputType, BiasType, format,
         }
       }
       if (fuse_relu) {
-        p0 = MAX(p0, z);
-        p1 = MAX(p1, z);
-        p2 = MAX(p2, z);
-        p3 = MAX(p3, z);
+        p0 = xc.activate<V, quantized>(p0);
+        p1 = xc.activate<V, quantized>(p1);
+        p2 = xc.activate<V, quantized>(p2);
+        p3 = xc.activate<V, quantized>(p3);
       }
       STORE(i, 0)
       STORE(i, 1)
@@ -46,31 +46,29 @@ namespace euler {
   if (fuse_bias) {FUSE_BIAS(p0##n)}                                            \
   if (fuse_ip_sum)                                                             \
     p0##n = ADD(p0##n, *(__m<V>*)P(0, n));                                     \
-  if (fuse_relu) {                                                             \
-    zero = XOR(zero, zero);                                                    \
-    p0##n = MAX(p0##n, zero);                                                  \
-  }                                                                            \
+  if (fuse_relu)                                                               \
+    p0##n = xc.activate<V>(p0##n);                                             \
   STORE(0, n)                                                                  \
   __m<V> p1##n = ADD(FMADD(z2, SUB(c2, c3), c0), FMSUB(z1_2, SUB(c4, c5), c1));\
   if (fuse_bias) {FUSE_BIAS(p1##n)}                                            \
   if (fuse_ip_sum)                                                             \
     p1##n = ADD(p1##n, *(__m<V>*)P(1, n));                                     \
   if (fuse_relu)                                                               \
-    p1##n = MAX(p1##n, zero);                                                  \
+    p1##n = xc.activate<V>(p1##n);                                             \
   STORE(1, n)                                                                  \
   __m<V> p2##n = ADD(FMADD(z4, ADD(c2, c3), c0), FMADD(z1_4, ADD(c4, c5), c1));\
   if (fuse_bias) {FUSE_BIAS(p2##n)}                                            \
   if (fuse_ip_sum)                                                             \
     p2##n = ADD(p2##n, *(__m<V>*)P(2, n));                                     \
   if (fuse_relu)                                                               \
-    p2##n = MAX(p2##n, zero);                                                  \
+    p2##n = xc.activate<V>(p2##n);                                             \
   STORE(2, n)                                                                  \
   __m<V> p3##n = ADD(FMADD(z8, SUB(c2, c3), c0), FMSUB(z1_8, SUB(c4, c5), c1));\
   if (fuse_bias) {FUSE_BIAS(p3##n)}                                            \
   if (fuse_ip_sum)                                                             \
     p3##n = ADD(p3##n, *(__m<V>*)P(3, n));                                     \
   if (fuse_relu)                                                               \
-    p3##n = MAX(p3##n, zero);                                                  \
+    p3##n = xc.activate<V>(p3##n);                                             \
   STORE(3, n)                                                                  \
   __m<V> p4##n = ADD(FMADD(z16, ADD(c2, c3), c0), FMADD(z1_16, ADD(c4, c5), c1));
 
@@ -79,7 +77,7 @@ namespace euler {
   if (fuse_ip_sum)                                                             \
     p4##n = ADD(p4##n, *(__m<V>*)P(4, n));                                     \
   if (fuse_relu)                                                               \
-    p4##n = MAX(p4##n, zero);                                                  \
+    p4##n = xc.activate<V>(p4##n);                                             \
   STORE(4, n)
 
 template <typename OutputType, typename BiasType,
@@ -124,7 +122,7 @@ struct elk_conv_wino_trans_output<float, OutputType, BiasType, format,
 #define T(_h, _w) (&md3(atoutput, _h, _w, 0))
 #define P(_h, _w) p_cb(_h, _w)
 
-    __m<V> c0, c1, c2, c3, c4, c5, zero;
+    __m<V> c0, c1, c2, c3, c4, c5;
 
     __m<V> z2 = _mm<V>::set_ps(IMM_BCAST16(2.0f));
     __m<V> z4 = _mm<V>::set_ps(IMM_BCAST16(4.0f));
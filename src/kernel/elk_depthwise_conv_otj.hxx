@@ -0,0 +1,152 @@
+#pragma once
+
+#include "el_intrin.hpp"
+#include "el_utils.hpp"
+#include "el_stl.hpp"
+#include "elx_conv.hpp"
+#include "elk_gemm_traits.hxx"
+
+// S: stride
+// F: format
+// T: tile blocking unit
+// K: kernel width
+// V: vector size
+// I: ISA
+
+namespace euler {
+
+// FP32 depth-wise conv kernel: T output pixels of a row, V channels.
+// Kernel height, padding and dilation are runtime.
+template <typename GarrayTypes, int V, int I, typename KP>
+struct depthwise_conv_kernel_otj {
+  static inline void conv(
+      elx_conv_params_t &,
+      typename GarrayTypes::OutputType *,
+      typename GarrayTypes::InputType *,
+      typename GarrayTypes::WeightsType *,
+      typename GarrayTypes::BiasType *,
+      int, int, int, int, bool, int) {}
+};
+
+template <typename GarrayTypes, int V, int ...Kp>
+struct depthwise_conv_kernel_otj<GarrayTypes, V, ISA_SKX_AVX512,
+    estl::integer_sequence<Kp...>> {
+  using kparams = estl::integer_sequence<Kp...>;
+  static_assert(sizeof...(Kp) == 4,
+      "Kernel parameters must be GarrayTypes, V, I, <S, F, T, K>");
+
+  using InputType = typename GarrayTypes::InputType;
+  using WeightsType = typename GarrayTypes::WeightsType;
+  using OutputType = typename GarrayTypes::OutputType;
+  using BiasType = typename GarrayTypes::BiasType;
+
+  constexpr static auto S = estl::get<0, int, kparams>();
+  constexpr static auto F = estl::get<1, int, kparams>();
+  constexpr static auto T = estl::get<2, int, kparams>();
+  constexpr static auto K = estl::get<3, int, kparams>();
+
+  static_assert(F_traits<F>::is_nhwc_input == F_traits<F>::is_nhwc_output,
+      "Depthwise conv: input and output of same format");
+
+  static inline __m<V> op_load_bias(BiasType *bias, __mmask16 k, bool has_Or)
+  {
+    if (has_Or)
+      return _mm512_maskz_loadu_ps(k, bias);
+    return _mm<V>::loadu_ps(bias);
+  }
+
+  static inline __m<V> op_load_weights(
+      elx_conv_params_t &xc, WeightsType *weights, int _kh, int _kw)
+  {
+    MD3(WeightsType, aweights, weights, xc.kh, K, V);
+    if (std::is_same<WeightsType, float>::value) {
+      return _mm<V>::load_ps(&md3(aweights, _kh, _kw, 0));
+    } else {
+      auto fp16v = _mm<V / 2>::load_si256(
+          (__m256i *)&md3(aweights, _kh, _kw, 0));
+      return _mm<V>::cvtph_ps(fp16v);
+    }
+  }
+
+  static inline __m<V> op_load_input(elx_conv_params_t &xc,
+      InputType *input, int _ih, int _iw, __mmask16 k, bool has_Or)
+  {
+    if (F_traits<F>::is_nhwc_input) {
+      MD3(InputType, ainput, input, xc.ih, xc.iw, xc.ic);
+      if (has_Or)
+        return _mm512_maskz_loadu_ps(k, &md3(ainput, _ih, _iw, 0));
+      return _mm<V>::loadu_ps(&md3(ainput, _ih, _iw, 0));
+    } else {
+      MD3(InputType, ainput, input, xc.ih, xc.iw, V);
+      return _mm<V>::load_ps(&md3(ainput, _ih, _iw, 0));
+    }
+  }
+
+  static inline OutputType *op_output(
+      elx_conv_params_t &xc, OutputType *output, int _T)
+  {
+    MD2(OutputType, aoutput_nhwc, output, T, xc.oc);
+    MD2(OutputType, aoutput_blocked, output, T, V);
+    return F_traits<F>::is_nhwc_output ? &md2(aoutput_nhwc, _T, 0)
+                                       : &md2(aoutput_blocked, _T, 0);
+  }
+
+  // output: first pixel of the tile
+  // input: (0, 0) of the channel block
+  // (_ih, _iw): input of (_kh = 0, _kw = 0, _T = 0), may be in padding
+  // border: some of the input columns of the tile are in padding
+  static inline void conv(elx_conv_params_t &xc, OutputType *output,
+      InputType *input, WeightsType *weights, BiasType *bias,
+      int _ih, int _iw, int khs, int khe, bool border, int attr)
+  {
+    __m<V> mmout[T];
+    __mmask16 k = _cvtu32_mask16(xc.ormask);
+    const bool has_Or = get_attr(attr, has_Or_idx);
+
+    if (get_attr(attr, bias_idx)) {
+      __m<V> mmbias = op_load_bias(bias, k, has_Or);
+      unroll_for (_T, T)
+        mmout[_T] = mmbias;
+    } else {
+      unroll_for (_T, T)
+        mmout[_T] = _mm<V>::setzero_ps();
+    }
+    if (get_attr(attr, ip_sum_idx)) {
+      unroll_for (_T, T) {
+        auto aout = op_output(xc, output, _T);
+        mmout[_T] += has_Or ? _mm512_maskz_loadu_ps(k, aout)
+                            : _mm<V>::loadu_ps(aout);
+      }
+    }
+
+    for (int _kh = khs; _kh < khe; ++_kh) {
+      int __ih = _ih + _kh * xc.hd;
+      unroll_for (_kw, K) {
+        __m<V> mmwei = op_load_weights(xc, weights, _kh, _kw);
+        int __iw = _iw + _kw * xc.wd;
+        unroll_for (_T, T) {
+          if (border && (__iw + _T * S < 0 || __iw + _T * S >= xc.iw))
+            continue;
+          __m<V> mmin = op_load_input(xc, input, __ih, __iw + _T * S, k, has_Or);
+          mmout[_T] = _mm<V>::fmadd_ps(mmwei, mmin, mmout[_T]);
+        }
+      }
+    }
+
+    if (get_attr(attr, relu_idx)) {
+      unroll_for (_T, T)
+        mmout[_T] = xc.activate<V>(mmout[_T]);
+    }
+    unroll_for (_T, T) {
+      auto aout = op_output(xc, output, _T);
+      if (has_Or)
+        _mm512_mask_storeu_ps(aout, k, mmout[_T]);
+      else if (F_traits<F>::is_nhwc_output)
+        _mm512_storeu_ps(aout, mmout[_T]);
+      else
+        _mm<V>::store_ps(aout, mmout[_T]);
+    }
+  }
+};
+
+} // namespace euler
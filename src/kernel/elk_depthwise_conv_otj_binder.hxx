@@ -0,0 +1,74 @@
+#pragma once
+
+#if !defined(BUILD_OTJ_TBL)
+#define DECL_DEPTHWISE_KCONV_TBL(type, V, I, S, F)                             \
+  static kconv<conv_impl::type>                                                \
+      *kconv_##type##_##V##_##I##_##S##_##F[16][5]
+#else
+#define DECL_DEPTHWISE_KCONV_TBL(type, V, I, S, F)                             \
+  __depthwise_kconv_generate_inst__ depthwise_conv type V I S F
+#endif
+
+#define LOOKUP_DEPTHWISE_KCONV_TBL(type, V, I, S, F, T, K)                     \
+  kconv_##type##_##V##_##I##_##S##_##F[T - 1][K - 3]
+
+#if !defined(BUILD_OTJ_TBL)
+#include "el_def.hpp"
+#include "src/kernel/elk_def.hpp"
+#include "src/kernel/elk_depthwise_conv_otj.hxx"
+
+namespace euler {
+
+struct depthwise_conv_kernel_binder {
+  template <typename GarrayTypes, int V, int I, int... Kp>
+  using conv_ker_cls = typename euler::depthwise_conv_kernel_otj<
+      GarrayTypes, V, I, estl::integer_sequence<Kp...>>;
+
+  template <typename GarrayTypes>
+  using kconv = decltype(conv_ker_cls<GarrayTypes, 1, 1, 1, 1, 1, 1>::conv);
+
+#endif // BUILD_OTJ_TBL
+
+  DECL_DEPTHWISE_KCONV_TBL(FP32, 16, ISA_SKX_AVX512, 1, GKF_DCD); // blocked
+  DECL_DEPTHWISE_KCONV_TBL(FP32, 16, ISA_SKX_AVX512, 2, GKF_DCD);
+  DECL_DEPTHWISE_KCONV_TBL(FP32, 16, ISA_SKX_AVX512, 1, GKF_FCF); // nhwc
+  DECL_DEPTHWISE_KCONV_TBL(FP32, 16, ISA_SKX_AVX512, 2, GKF_FCF);
+  DECL_DEPTHWISE_KCONV_TBL(FP32_F16w, 16, ISA_SKX_AVX512, 1, GKF_DCD); // f16c
+  DECL_DEPTHWISE_KCONV_TBL(FP32_F16w, 16, ISA_SKX_AVX512, 2, GKF_DCD);
+  DECL_DEPTHWISE_KCONV_TBL(FP32_F16w, 16, ISA_SKX_AVX512, 1, GKF_FCF);
+  DECL_DEPTHWISE_KCONV_TBL(FP32_F16w, 16, ISA_SKX_AVX512, 2, GKF_FCF);
+
+#if !defined(BUILD_OTJ_TBL)
+
+#  define DEF_DEPTHWISE_CONV_BIND(type)                                     \
+    template <int S, int F>                                                 \
+    static inline void bind(int T, int K, kconv<conv_impl::type> **func) {  \
+      switch (F) {                                                          \
+      case GKF_DCD:                                                         \
+        if (S == 1)                                                         \
+          *func = LOOKUP_DEPTHWISE_KCONV_TBL(                               \
+              type, 16, ISA_SKX_AVX512, 1, GKF_DCD, T, K);                  \
+        else if (S == 2)                                                    \
+          *func = LOOKUP_DEPTHWISE_KCONV_TBL(                               \
+              type, 16, ISA_SKX_AVX512, 2, GKF_DCD, T, K);                  \
+        break;                                                              \
+      case GKF_FCF:                                                         \
+        if (S == 1)                                                         \
+          *func = LOOKUP_DEPTHWISE_KCONV_TBL(                               \
+              type, 16, ISA_SKX_AVX512, 1, GKF_FCF, T, K);                  \
+        else if (S == 2)                                                    \
+          *func = LOOKUP_DEPTHWISE_KCONV_TBL(                               \
+              type, 16, ISA_SKX_AVX512, 2, GKF_FCF, T, K);                  \
+        break;                                                              \
+      default:                                                              \
+        el_error("Unimlemented conv kernel format");                        \
+        break;                                                              \
+      }                                                                     \
+    }
+
+  DEF_DEPTHWISE_CONV_BIND(FP32)
+  DEF_DEPTHWISE_CONV_BIND(FP32_F16w)
+#endif // BUILD_OTJ_TBL
+};
+
+} // namespace euler
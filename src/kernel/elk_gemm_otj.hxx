@@ -228,10 +228,8 @@ struct gemm_kernel_otj<GarrayTypes, V, Vx, ISA_SKX_AVX512,
               : F_traits<F>::is_blocked_output
               ? &md2(aoutput_blocked1, _T, 0) : &md3(aoutput_nhwc1, 0, _O, 0);
 
-    if (get_attr(attr, relu_idx)) {
-      __m<V> zero = _mm<V>::setzero_ps();
-      res = _mm<V>::max_ps(res, zero);
-    }
+    if (get_attr(attr, relu_idx))
+      res = xc.activate<V>(res);
     if (get_attr(attr, s_output_idx)) {
       if (std::is_same<OutputType, float>::value) {
         _mm<V>::stream_ps(aout, res);
@@ -268,10 +266,8 @@ struct gemm_kernel_otj<GarrayTypes, V, Vx, ISA_SKX_AVX512,
               ? &md2(aoutput_blocked1, _T, 0) : &md3(aoutput_nhwc1, 0, _O, 0);
     assert(F_traits<F>::is_nhwc_output);
 
-    if (get_attr(attr, relu_idx)) {
-      __m<V> zero = _mm<V>::setzero_ps();
-      res = _mm<V>::max_ps(res, zero);
-    }
+    if (get_attr(attr, relu_idx))
+      res = xc.activate<V>(res);
     if (std::is_same<OutputType, float>::value) {
       _mm512_mask_store_ps(aout, k, res);
     } else {
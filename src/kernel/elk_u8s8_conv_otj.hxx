@@ -223,9 +223,10 @@ struct u8s8_conv_kernel_otj<GarrayTypes, RoutputType, V, Vx, ISA_SKX_AVX512,
     auto factor = *(__m<V> *)&md3(aweights_factor, _O, _T, 0);
     fout = fout * scale + factor;
 
-    // fuse relu
+    // fuse activation
     if (get_attr(attr, relu_idx)) {
-      fout = _mm<V>::max_ps(fout, _mm<V>::setzero_ps());
+      fout = xc.activate<V, std::is_same<RoutputType, uint8_t>::value
+          || std::is_same<RoutputType, int8_t>::value>(fout);
     }
     // store output
     if (std::is_same<RoutputType, uint8_t>::value
@@ -237,9 +237,10 @@ struct u8s8_depthwise_conv_kernel_otj<GarrayTypes, RoutputType, V, Vx,
     auto factor = *(__m<V> *)&md1(aweights_factor, 0);
     fout = fout * scale + factor;
 
-    // fuse relu
+    // fuse activation
     if (get_attr(attr, relu_idx)) {
-      fout = _mm<V>::max_ps(fout, _mm<V>::setzero_ps());
+      fout = xc.activate<V, std::is_same<RoutputType, uint8_t>::value
+          || std::is_same<RoutputType, int8_t>::value>(fout);
     }
     // store output
     if (std::is_same<RoutputType, uint8_t>::value
@@ -272,10 +273,9 @@ struct u8s8_depthwise_conv_kernel_otj<GarrayTypes, RoutputType, V, Vx,
     __m<V> fout = _mm<V>::cvtepi32_ps(res);
     fout = fout * scale + factor;
 
-    // fuse relu
-    if (get_attr(attr, relu_idx)) {
-      fout = _mm<V>::max_ps(fout, _mm<V>::setzero_ps());
-    }
+    // fuse activation
+    if (get_attr(attr, relu_idx))
+      fout = xc.activate<V, true>(fout);
 
     // return output
     __i<V> u32 = _mm<V>::cvt_roundps_epi32(
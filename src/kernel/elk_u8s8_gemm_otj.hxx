@@ -240,9 +240,10 @@ struct u8s8_gemm_kernel_otj<GarrayTypes, OoutputType, V, Vx, ISA_SKX_AVX512,
       }
     }
 
-    // fuse relu
+    // fuse activation
     if (get_attr(attr, relu_idx)) {
-      fout = _mm<V>::max_ps(fout, _mm<V>::setzero_ps());
+      fout = xc.activate<V, std::is_same<OoutputType, uint8_t>::value
+          || std::is_same<OoutputType, int8_t>::value>(fout);
     }
     // store output
     if (std::is_same<OoutputType, uint8_t>::value
@@ -229,10 +229,8 @@ struct vmg_conv_kernel_otj<GarrayTypes, V, Vx, ISA_SKX_AVX512,
               : F_traits<F>::is_blocked_output
               ? &md2(aoutput_blocked1, _T, 0) : &md3(aoutput_nhwc1, 0, _O, 0);
 
-    if (get_attr(attr, relu_idx)) {
-      __m<V> zero = _mm<V>::setzero_ps();
-      res = _mm<V>::max_ps(res, zero);
-    }
+    if (get_attr(attr, relu_idx))
+      res = xc.activate<V>(res);
     if (get_attr(attr, s_output_idx)) {
       if (std::is_same<OutputType, float>::value) {
         _mm<V>::stream_ps(aout, res);
@@ -269,10 +267,8 @@ struct vmg_conv_kernel_otj<GarrayTypes, V, Vx, ISA_SKX_AVX512,
               ? &md2(aoutput_blocked1, _T, 0) : &md3(aoutput_nhwc1, 0, _O, 0);
     assert(F_traits<F>::is_nhwc_output);
 
-    if (get_attr(attr, relu_idx)) {
-      __m<V> zero = _mm<V>::setzero_ps();
-      res = _mm<V>::max_ps(res, zero);
-    }
+    if (get_attr(attr, relu_idx))
+      res = xc.activate<V>(res);
     if (std::is_same<OutputType, float>::value) {
       _mm512_mask_store_ps(aout, k, res);
     } else {
@@ -288,17 +284,27 @@ struct vmg_conv_kernel_otj<GarrayTypes, V, Vx, ISA_SKX_AVX512,
       const int _ih, const int _iw, const int _I2, const int _V, const int _T)
   {
     __m<V> vin;
+    InputType *pin;
     if (F_traits<F>::is_nhwc_input) {
       MD3(InputType, ainput0, input, xc.ih, xc.iw, xc.g * xc.ic);
       MD5(InputType, ainput1, &md3(ainput0, _ih, _iw, 0), xc.wt, T, S, xc.g, xc.ic);
       MD4(InputType, ainput2, &md5(ainput1, 0, _T, 0, 0, 0), xc.ic4, xc.ic3, xc.I2, V);
-      vin = _mm<V>::load_ps(&md4(ainput2, 0, 0, _I2, 0));
+      pin = &md4(ainput2, 0, 0, _I2, 0);
     } else { // blocked
       MD4(InputType, ainput0, input, xc.I2, xc.ih, xc.iw, V);
       MD3(InputType, ainput1, &md4(ainput0, _I2, _ih, _iw, 0), T, S, V);
-      vin = _mm<V>::load_ps(&md3(ainput1, _T, 0, 0));
+      pin = &md3(ainput1, _T, 0, 0);
     }
 
+    if (xc.icg != C) {
+      // G * icg (< V) channels, not necessarily aligned
+      __mmask16 k = _cvtu32_mask16((1 << xc.ic) - 1);
+      vin = _mm512_maskz_loadu_ps(k, pin);
+      __m512i idx = _mm512_loadu_si512(&xc.vmg_perm[_V * V]);
+      return _mm512_permutexvar_ps(idx, vin);
+    }
+    vin = _mm<V>::load_ps(pin);
+
     if (V == 16) {
       if (G == 1) {
         // _V = 0..15
@@ -357,9 +363,11 @@ struct vmg_conv_kernel_otj<GarrayTypes, V, Vx, ISA_SKX_AVX512,
     //  Ir = xc.Ir;
     //}
     int I2 = xc.I2;
+    // input channels per group, icg <= C
+    const int Ci = xc.icg;
 
     //int Vr = F_traits<F>::is_compact_ir_weights ? xc.Ir : V;
-    MD3(WeightsType, aweights, weights, xc.kh, xc.kw, xc.O1 * I2 * C * O * V); // compact
+    MD3(WeightsType, aweights, weights, xc.kh, xc.kw, xc.O1 * I2 * Ci * O * V); // compact
 
     __m<V> mmout[JO][T], mmwei[JO][P];
     __mmask16 k = _cvtu32_mask16(xc.ormask);
@@ -417,6 +425,7 @@ struct vmg_conv_kernel_otj<GarrayTypes, V, Vx, ISA_SKX_AVX512,
     auto gemm_OVT = [&](InputType *input_, WeightsType *weights_,
                         int _kh, int _kw, int _I2) {
       unroll_for(_V, C) {
+        if (_V >= Ci) break;
         unroll_auto(_O, JO)
           mmwei[_O][0] = op_load_weights<JO, P>(xc, weights_, _I2, _V, 0, _O);
         unroll_for(_T, T) {
@@ -428,6 +437,7 @@ struct vmg_conv_kernel_otj<GarrayTypes, V, Vx, ISA_SKX_AVX512,
     auto gemm_OVxT = [&](InputType *input_, WeightsType *weights_,
                          int _kh, int _kw, int _I2) {
       unroll_for(_V, C) {
+        if (_V >= Ci) break;
         unroll_auto(_O, JO)
           mmwei[_O][0] = op_load_weights<JO, P>(xc, weights_, _I2, _V, 0, _O);
         unroll_from_to(_T, (AKW + S - 1)/S, T) {
@@ -439,6 +449,7 @@ struct vmg_conv_kernel_otj<GarrayTypes, V, Vx, ISA_SKX_AVX512,
     auto gemm_OVxxT = [&](InputType *input_, WeightsType *weights_,
                           int _kh, int _kw, int _I2) {
       unroll_for(_V, C) {
+        if (_V >= Ci) break;
         unroll_auto(_O, JO)
           mmwei[_O][0] = op_load_weights<JO, P>(xc, weights_, _I2, _V, 0, _O);
         unroll_from_to(_T, (AKW - 1 + S - 1)/S, T) {
@@ -450,6 +461,7 @@ struct vmg_conv_kernel_otj<GarrayTypes, V, Vx, ISA_SKX_AVX512,
     auto gemm_OVxxxT = [&](InputType *input_, WeightsType *weights_,
                            int _kh, int _kw, int _I2) {
       unroll_for(_V, C) {
+        if (_V >= Ci) break;
         unroll_auto(_O, JO)
           mmwei[_O][0] = op_load_weights<JO, P>(xc, weights_, _I2, _V, 0, _O);
         unroll_from_to(_T, (AKW - 2 + S - 1)/S, T) {
@@ -461,6 +473,7 @@ struct vmg_conv_kernel_otj<GarrayTypes, V, Vx, ISA_SKX_AVX512,
     auto gemm_OVTx = [&](InputType *input_, WeightsType *weights_,
                          int _kh, int _kw, int _I2) {
       unroll_for(_V, C) {
+        if (_V >= Ci) break;
         unroll_auto(_O, JO)
           mmwei[_O][0] = op_load_weights<JO, P>(xc, weights_, _I2, _V, 0, _O);
         unroll_for(_T, T - AKW/S) {
@@ -472,6 +485,7 @@ struct vmg_conv_kernel_otj<GarrayTypes, V, Vx, ISA_SKX_AVX512,
     auto gemm_OVTxx = [&](InputType *input_, WeightsType *weights_,
                           int _kh, int _kw, int _I2) {
       unroll_for(_V, C) {
+        if (_V >= Ci) break;
         unroll_auto(_O, JO)
           mmwei[_O][0] = op_load_weights<JO, P>(xc, weights_, _I2, _V, 0, _O);
         unroll_for(_T, T - (AKW - 1)/S) {
@@ -483,6 +497,7 @@ struct vmg_conv_kernel_otj<GarrayTypes, V, Vx, ISA_SKX_AVX512,
     auto gemm_OVTxxx = [&](InputType *input_, WeightsType *weights_,
                            int _kh, int _kw, int _I2) {
       unroll_for(_V, C) {
+        if (_V >= Ci) break;
         unroll_auto(_O, JO)
           mmwei[_O][0] = op_load_weights<JO, P>(xc, weights_, _I2, _V, 0, _O);
         unroll_for(_T, T - (AKW - 2)/S) {
@@ -809,7 +824,11 @@ struct vmg_conv_kernel_otj<GarrayTypes, V, Vx, ISA_SKX_AVX512,
     for (int _O1 = 0; _O1 < xc.O1; ++_O1) {
       auto aout = F_traits<F>::is_nhwc_output ? &md5(aoutput_nhwc, 0, 0, 0, _O1, 0)
                                               : &md2(aoutput_blocked, _O1, 0);
-      if (F_traits<F>::is_nhwc_output && get_attr(attr, has_Or_idx)
+      if (xc.icg != C) {
+        // icg < C, permuted input, no weights pipelining
+        op_conv<JO0, 1, false>(xc, aout, input, &md3(aweights, 0, _O1, 0),
+            &md2(abias, _O1, 0), _wt, khs, khe, kws, kwe, attr);
+      } else if (F_traits<F>::is_nhwc_output && get_attr(attr, has_Or_idx)
           && _O1 == xc.O1 - 1) {
         op_conv<JO0, JP0, true>(xc, aout, input, &md3(aweights, 0, _O1, 0),
             &md2(abias, _O1, 0), _wt, khs, khe, kws, kwe, attr);
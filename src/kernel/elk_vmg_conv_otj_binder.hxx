@@ -34,6 +34,10 @@ struct vmg_conv_kernel_binder {
   DECL_VMG_KCONV_TBL(FP32, 16, 1, ISA_SKX_AVX512, 1, GKF_FCF); // direct, nhwc
   DECL_VMG_KCONV_TBL(FP32_F16w, 16, 1, ISA_SKX_AVX512, 1, GKF_DCD); // direct, blocked, f16c
   DECL_VMG_KCONV_TBL(FP32_F16w, 16, 1, ISA_SKX_AVX512, 1, GKF_FCF); // direct, nhwc input, f16c
+  DECL_VMG_KCONV_TBL(FP32, 16, 1, ISA_SKX_AVX512, 2, GKF_DCD); // direct, blocked, stride 2
+  DECL_VMG_KCONV_TBL(FP32, 16, 1, ISA_SKX_AVX512, 2, GKF_FCF); // direct, nhwc, stride 2
+  DECL_VMG_KCONV_TBL(FP32_F16w, 16, 1, ISA_SKX_AVX512, 2, GKF_DCD); // direct, blocked, f16c, stride 2
+  DECL_VMG_KCONV_TBL(FP32_F16w, 16, 1, ISA_SKX_AVX512, 2, GKF_FCF); // direct, nhwc input, f16c, stride 2
   //DECL_VMG_KCONV_TBL(FP32_F16o, 16, 1, ISA_SKX_AVX512, 1, GKF_DCD); // direct, f16c
 
 #ifdef ENABLE_USER_FP16
@@ -68,10 +72,14 @@ struct vmg_conv_kernel_binder {
     case GKF_DCD:
       if (S == 1)
         *func = LOOKUP_VMG_KCONV_TBL(FP32, 16, 1, ISA_SKX_AVX512, 1, GKF_DCD, O, T, K, G);
+      else if (S == 2)
+        *func = LOOKUP_VMG_KCONV_TBL(FP32, 16, 1, ISA_SKX_AVX512, 2, GKF_DCD, O, T, K, G);
       break;
     case GKF_FCF:
       if (S == 1)
         *func = LOOKUP_VMG_KCONV_TBL(FP32, 16, 1, ISA_SKX_AVX512, 1, GKF_FCF, O, T, K, G);
+      else if (S == 2)
+        *func = LOOKUP_VMG_KCONV_TBL(FP32, 16, 1, ISA_SKX_AVX512, 2, GKF_FCF, O, T, K, G);
       break;
     default:
       break;
@@ -85,10 +93,14 @@ struct vmg_conv_kernel_binder {
     case GKF_DCD:
       if (S == 1)
         *func = LOOKUP_VMG_KCONV_TBL(FP32_F16w, 16, 1, ISA_SKX_AVX512, 1, GKF_DCD, O, T, K, G);
+      else if (S == 2)
+        *func = LOOKUP_VMG_KCONV_TBL(FP32_F16w, 16, 1, ISA_SKX_AVX512, 2, GKF_DCD, O, T, K, G);
       break;
     case GKF_FCF:
       if (S == 1)
         *func = LOOKUP_VMG_KCONV_TBL(FP32_F16w, 16, 1, ISA_SKX_AVX512, 1, GKF_FCF, O, T, K, G);
+      else if (S == 2)
+        *func = LOOKUP_VMG_KCONV_TBL(FP32_F16w, 16, 1, ISA_SKX_AVX512, 2, GKF_FCF, O, T, K, G);
       break;
     default:
       break;
@@ -0,0 +1,95 @@
+#!/bin/bash
+
+# Build 2-D blocked conv kernel instantiation
+#
+
+src_file=$1; dst_dir=$2; cc=$3; enable_user_fp16=$4
+
+if [ ! -f $src_file ] || [ ! -d $dst_dir ]; then
+  "Invalid src_file=$src_file or dst_dir=$dst_dir"
+  exit -1
+fi
+
+# O * H * T <= 28 accumulators
+__kconv_2d_generate_inst__() {
+  ktype=$1; dtype=$2; V=$3; I=$4; S=$5; F=$6;
+
+  cat <<@ > $dst_dir/elk_${ktype}_otj_${dtype}_${V}_${I}_${S}_${F}.cpp
+// _generated_kernel_file_
+//
+#include "$src_file"
+
+using namespace euler;
+
+namespace euler {
+
+#undef E
+#define E(O, H, T) \\
+  ${ktype}_kernel_binder::conv_ker_cls<conv_impl::$dtype, \\
+      $V, $I, $S, $F, O, H, T>::conv
+  ${ktype}_kernel_binder::kconv<conv_impl::$dtype>
+      *${ktype}_kernel_binder::kconv_${dtype}_${V}_${I}_${S}_${F}[2][4][14] =
+  { // 2
+    { // O = 1
+      { // H = 1
+        E(1, 1,  1), E(1, 1,  2), E(1, 1,  3), E(1, 1,  4),
+        E(1, 1,  5), E(1, 1,  6), E(1, 1,  7), E(1, 1,  8),
+        E(1, 1,  9), E(1, 1, 10), E(1, 1, 11), E(1, 1, 12),
+        E(1, 1, 13), E(1, 1, 14),
+      },
+      { // H = 2
+        E(1, 2,  1), E(1, 2,  2), E(1, 2,  3), E(1, 2,  4),
+        E(1, 2,  5), E(1, 2,  6), E(1, 2,  7), E(1, 2,  8),
+        E(1, 2,  9), E(1, 2, 10), E(1, 2, 11), E(1, 2, 12),
+        E(1, 2, 13), E(1, 2, 14),
+      },
+      { // H = 3
+        E(1, 3,  1), E(1, 3,  2), E(1, 3,  3), E(1, 3,  4),
+        E(1, 3,  5), E(1, 3,  6), E(1, 3,  7), E(1, 3,  8),
+        E(1, 3,  9), nullptr, nullptr, nullptr,
+        nullptr, nullptr,
+      },
+      { // H = 4
+        E(1, 4,  1), E(1, 4,  2), E(1, 4,  3), E(1, 4,  4),
+        E(1, 4,  5), E(1, 4,  6), E(1, 4,  7), nullptr,
+        nullptr, nullptr, nullptr, nullptr,
+        nullptr, nullptr,
+      },
+    },
+    { // O = 2
+      { // H = 1
+        E(2, 1,  1), E(2, 1,  2), E(2, 1,  3), E(2, 1,  4),
+        E(2, 1,  5), E(2, 1,  6), E(2, 1,  7), E(2, 1,  8),
+        E(2, 1,  9), E(2, 1, 10), E(2, 1, 11), E(2, 1, 12),
+        E(2, 1, 13), E(2, 1, 14),
+      },
+      { // H = 2
+        E(2, 2,  1), E(2, 2,  2), E(2, 2,  3), E(2, 2,  4),
+        E(2, 2,  5), E(2, 2,  6), E(2, 2,  7), nullptr,
+        nullptr, nullptr, nullptr, nullptr,
+        nullptr, nullptr,
+      },
+      { // H = 3
+        E(2, 3,  1), E(2, 3,  2), E(2, 3,  3), E(2, 3,  4),
+        nullptr, nullptr, nullptr, nullptr,
+        nullptr, nullptr, nullptr, nullptr,
+        nullptr, nullptr,
+      },
+      { // H = 4
+        E(2, 4,  1), E(2, 4,  2), E(2, 4,  3), nullptr,
+        nullptr, nullptr, nullptr, nullptr,
+        nullptr, nullptr, nullptr, nullptr,
+        nullptr, nullptr,
+      },
+    },
+  };
+
+} // namespace
+@
+}
+
+if [ $enable_user_fp16 == "ON" ]; then
+  eval $($cc -DENABLE_USER_FP16 -DBUILD_OTJ_TBL -E $src_file 2>&1 | grep _generate_inst_)
+else
+  eval $($cc -DBUILD_OTJ_TBL -E $src_file 2>&1 | grep _generate_inst_)
+fi
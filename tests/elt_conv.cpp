@@ -10,6 +10,7 @@
 #include "euler.hpp"
 #include <iostream>
 #include <unordered_map>
+#include <vector>
 #include "elt_gflag.hpp"
 
 
@@ -20,6 +21,17 @@ int mb = 0, g = 1, ic = 0, ih = 0, iw = 0, oc = 0, oh = 0, ow = 0, kh = 3, kw =
 int ph = 1, pw = 1, sh = 1, sw = 1, dh = 1, dw = 1;
 bool with_bias = true, with_relu = false, with_ip_sum = false,
      with_argmax = false, f16c_opt = false, disable_autoparam = true;
+bool output_quant_oc = false;
+bool observe = false;
+bool bn = false;
+bool with_pool = false;
+int pool_alg = POOL_MAX, pool_k = 2, pool_s = 2;
+int act_alg = ACT_RELU;
+float act_alpha = 0.0f, act_beta = 0.0f;
+int input_view_c = 0, input_view_c_off = 0, input_view_h = 0,
+    input_view_h_off = 0, input_view_w = 0, input_view_w_off = 0;
+int output_view_c = 0, output_view_c_off = 0, output_view_h = 0,
+    output_view_h_off = 0, output_view_w = 0, output_view_w_off = 0;
 int data_type_cfg = 0;
 int prop_kind = forward_inference, alg = CONV_AUTO;
 int input_format = nChw16c, weights_format = OIhw16i16o,
@@ -39,6 +51,10 @@ bool validate_results = false;
 int repeated_layer = 1;
 bool double_buffering = false;
 bool output_as_input = false;
+bool with_view = false;
+bool input_prepadded = false;
+int gemm = 0;
+eld_gemm_t *gemms = nullptr;
 
 bool is_int8_lp = false;
 bool with_real_data = false;
@@ -87,6 +103,27 @@ int parse_cmd_options(int argc, char **argv) {
   output_as_blocked = FLAGS_output_as_blocked;
   f16c_opt = FLAGS_f16c_opt;
   with_ip_sum = FLAGS_with_ip_sum;
+  output_quant_oc = FLAGS_output_quant_oc;
+  observe = FLAGS_observe;
+  bn = FLAGS_bn;
+  pool_k = FLAGS_pool_k;
+  pool_s = FLAGS_pool_s;
+  act_alpha = FLAGS_act_alpha;
+  act_beta = FLAGS_act_beta;
+  input_view_c = FLAGS_input_view_c;
+  input_view_c_off = FLAGS_input_view_c_off;
+  output_view_c = FLAGS_output_view_c;
+  output_view_c_off = FLAGS_output_view_c_off;
+  input_view_h = FLAGS_input_view_h;
+  input_view_h_off = FLAGS_input_view_h_off;
+  input_view_w = FLAGS_input_view_w;
+  input_view_w_off = FLAGS_input_view_w_off;
+  output_view_h = FLAGS_output_view_h;
+  output_view_h_off = FLAGS_output_view_h_off;
+  output_view_w = FLAGS_output_view_w;
+  output_view_w_off = FLAGS_output_view_w_off;
+  input_prepadded = FLAGS_input_prepadded;
+  gemm = FLAGS_gemm;
   sampling_kind = (sampling_kind_t)FLAGS_sampling_kind;
   tinput_cali_s = FLAGS_tinput_cali_s;
   tinput_cali_z = FLAGS_tinput_cali_z;
@@ -96,6 +133,8 @@ int parse_cmd_options(int argc, char **argv) {
                  ::toupper);
   if (FLAGS_alg == "DECONV")
     alg = DECONV_DIRECT;
+  else if (FLAGS_alg == "DECONV_SUBPIXEL")
+    alg = DECONV_SUBPIXEL;
   else if (FLAGS_alg == "AUTO")
     alg = CONV_AUTO;
   else if (FLAGS_alg == "WINO")
@@ -108,7 +147,7 @@ int parse_cmd_options(int argc, char **argv) {
     alg = CONV_DIRECT_1X1;
   else {
     printf("Error: convolution options: alg should be "
-           "deconv|auto|wino|direct|direct_vmg|direct_1x1\n");
+           "deconv|deconv_subpixel|auto|wino|direct|direct_vmg|direct_1x1\n");
     return -1;
   }
 
@@ -122,7 +161,8 @@ int parse_cmd_options(int argc, char **argv) {
     is_int8_lp = true;
   } else if (alg == CONV_DIRECT_1X1 && (execution_mode == 0xc160 || execution_mode == 0xb161)) {
     is_int8_lp = true;
-  } else if (alg == CONV_DIRECT && (execution_mode == 0xd160 || execution_mode == 0xa160)) {
+  } else if ((alg == CONV_DIRECT || alg == DECONV_DIRECT) &&
+             (execution_mode == 0xd160 || execution_mode == 0xa160)) {
     is_int8_lp = true;
   }
 
@@ -190,6 +230,33 @@ int parse_cmd_options(int argc, char **argv) {
     data_type_cfg = euler::test::FP32;
   }
 
+  if (FLAGS_pool == "off")
+    with_pool = false;
+  else if (FLAGS_pool == "max") {
+    with_pool = true;
+    pool_alg = POOL_MAX;
+  } else if (FLAGS_pool == "avg") {
+    with_pool = true;
+    pool_alg = POOL_AVG;
+  } else {
+    printf("Error: convolution options: pool should be off|max|avg\n");
+    return -1;
+  }
+
+  std::unordered_map<std::string, int> act_algs {
+    {"relu", ACT_RELU}, {"leaky_relu", ACT_LEAKY_RELU}, {"clip", ACT_CLIP},
+    {"sigmoid", ACT_SIGMOID}, {"swish", ACT_SWISH},
+    {"gelu_tanh", ACT_GELU_TANH}, {"gelu_erf", ACT_GELU_ERF}
+  };
+  if (act_algs.find(FLAGS_act) == act_algs.end()) {
+    printf("Error: convolution options: act should be relu|leaky_relu|clip|"
+           "sigmoid|swish|gelu_tanh|gelu_erf\n");
+    return -1;
+  }
+  act_alg = act_algs[FLAGS_act];
+  if (act_alg != ACT_RELU)
+    with_relu = true;
+
   if (FLAGS_input_data_file != "") {
     const char *t = FLAGS_input_data_file.c_str();
     input_file = t == nullptr ? nullptr : strdup(t);
@@ -209,6 +276,14 @@ int parse_cmd_options(int argc, char **argv) {
            "double-buffering\n");
     return -1;
   }
+  // pre-padded input is staged like a view
+  with_view = input_view_c || input_view_h || input_view_w
+      || output_view_c || output_view_h || output_view_w || input_prepadded;
+  if (with_view && (output_as_input || double_buffering)) {
+    printf("Error: convolution options: tensor views are exclusive with "
+           "output-as-input and double-buffering\n");
+    return -1;
+  }
 
   iw = iw == 0 ? ih : iw;
   ow = ow == 0 ? oh : ow;
@@ -217,14 +292,19 @@ int parse_cmd_options(int argc, char **argv) {
          "mb:%d, g:%d, ic:%d, ih:%d, iw:%d, oc:%d, oh:%d, ow:%d, kh:%d, kw:%d, "
          "ph:%d, pw:%d, sh:%d, sw:%d, dh:%d, dw:%d\n"
          "with_bias:%d, with_relu:%d, with_ip_sum:%d, with_argmax:%d, "
-         "f16c_opt=%d, data_type_cfg=%d, validate_results:%d\n"
+         "f16c_opt=%d, data_type_cfg=%d, output_quant_oc=%d, observe=%d, "
+         "validate_results:%d\n"
+         "with_pool:%d, pool_alg:%d, pool_k:%d, pool_s:%d, bn:%d\n"
+         "act_alg:%d, act_alpha:%f, act_beta:%f\n"
          "flt_o:%d, flt_t:%d, blk_i:%d, blk_o:%d, pat_i:%d, pat_o:%d\n"
          "streaming-hint:%d, %d\n"
          "nthreads:%d\n"
          "execution-mode:%x\n",
          mb, g, ic, ih, iw, oc, oh, ow, kh, kw, ph, pw, sh, sw, dh, dw,
          with_bias, with_relu, with_ip_sum, with_argmax,
-         f16c_opt, data_type_cfg, validate_results,
+         f16c_opt, data_type_cfg, output_quant_oc, observe, validate_results,
+         with_pool, pool_alg, pool_k, pool_s, bn,
+         act_alg, act_alpha, act_beta,
          flt_o, flt_t, blk_i, blk_o, pat_i, pat_o, streaming_input,
          streaming_output, nthreads, execution_mode);
 
@@ -255,6 +335,14 @@ int parse_cmd_options(int argc, char **argv) {
          input_as_blocked, weights_as_blocked, output_as_blocked);
   printf("double_buffering: %d, output_as_input=%d\n", double_buffering,
          output_as_input);
+  printf("input_view: c:%d, c_off:%d, h:%d, h_off:%d, w:%d, w_off:%d\n",
+         input_view_c, input_view_c_off, input_view_h, input_view_h_off,
+         input_view_w, input_view_w_off);
+  printf("output_view: c:%d, c_off:%d, h:%d, h_off:%d, w:%d, w_off:%d\n",
+         output_view_c, output_view_c_off, output_view_h, output_view_h_off,
+         output_view_w, output_view_w_off);
+  printf("input_prepadded:%d\n", input_prepadded);
+  printf("gemm:%d\n", gemm);
 
   // TODO: support tinput quantization only so far
   if (sampling_kind == euler::CALIBRATED && tinput_cali_s == 0.0 &&
@@ -273,6 +361,19 @@ int parse_cmd_options(int argc, char **argv) {
     printf("sampling-kind<FINE>\n");
   }
 
+  if (gemm && (g != 1 || kh != 1 || kw != 1 || sh != 1 || sw != 1 ||
+               ph != 0 || pw != 0 || output_format != nhwc || with_view ||
+               (weights_format != hwio && weights_format != oihw))) {
+    printf("Error: convolution options: gemm for 1x1 conv of nhwc output, "
+           "hwio|oihw weights, no views only\n");
+    return -1;
+  }
+  if (gemm == 2 && data_type_cfg != euler::test::FP32) {
+    printf("Error: convolution options: gemm batch of pointers for FP32 "
+           "only\n");
+    return -1;
+  }
+
   if (mb <= 0 || g <= 0 || ic <= 0 || ih <= 0 || iw <= 0 || oc <= 0 ||
       oh <= 0 || ow <= 0 || kh <= 0 || kw <= 0) {
     printf("Error: convolution options: mb|g|ic|ih|iw|oc|oh|ow|kh|kw should "
@@ -309,10 +410,14 @@ static inline eld_conv_t &create_conv_desc(eld_conv_t &desc,
   desc.formats = {input_format, weights_format, output_format};
   desc.pads = {pw, pw, ph, ph};
   desc.strides = {sh, sw};
+  desc.dilations = {dh, dw};
   desc.with_bias = with_bias;
   desc.with_argmax = with_argmax;
+  desc.with_pool = with_pool;
+  desc.pool = { pool_alg, pool_k, pool_k, pool_s, pool_s, 0, 0 };
   desc.with_ip_sum = with_ip_sum;
   desc.with_relu = with_relu;
+  desc.activation = { act_alg, act_alpha, act_beta };
   desc.f16c_opt = f16c_opt;
   desc.algorithm = alg;
   desc.tile_size = tile_size;
@@ -376,6 +481,43 @@ static inline int conv_ref_setup(eld_conv_t &desc) {
   return desc.setup(fully_setup);
 }
 
+// GEMM of the 1x1 conv: m = ih * iw pixels of an image, batch of mb
+// images; nchw input as A^T, oihw weights as B^T
+static inline int gemm_setup(eld_conv_t &desc, eld_gemm_t &gd) {
+  gd.dims = {desc.dims.ih * desc.dims.iw, desc.dims.oc, desc.dims.ic,
+             desc.dims.n};
+  gd.trans = {desc.formats.input == nchw, desc.formats.weights == oihw};
+  gd.data_type = {desc.data_type.input, desc.data_type.weights,
+                  desc.data_type.output, desc.data_type.bias};
+  gd.a_quant = {desc.input_quant.scale, desc.input_quant.z};
+  gd.c_quant = {desc.output_quant.scale, desc.output_quant.z};
+  gd.with_bias = desc.with_bias;
+  gd.with_sum = desc.with_ip_sum;
+  gd.with_relu = desc.with_relu;
+  gd.activation = {desc.activation.alg, desc.activation.alpha,
+                   desc.activation.beta};
+  gd.nthreads = desc.nthreads;
+  return gd.setup();
+}
+
+static inline int conv_run(eld_conv_t &desc, int c, void *output,
+                           void *input, void *weights, void *bias) {
+  if (gemm == 2) {
+    // matrices of the batch by pointers, weights of all
+    eld_gemm_t &gd = gemms[c];
+    std::vector<void *> cs(gd.dims.batch), as(gd.dims.batch),
+        bs(gd.dims.batch, weights);
+    for (int _b = 0; _b < gd.dims.batch; ++_b) {
+      cs[_b] = (float *)output + (size_t)_b * gd.dims.m * gd.dims.n;
+      as[_b] = (float *)input + (size_t)_b * gd.dims.m * gd.dims.k;
+    }
+    return elx_gemm_batch(gd, cs.data(), as.data(), bs.data(), bias);
+  }
+  if (gemm)
+    return elx_gemm(gemms[c], output, input, weights, bias);
+  return elx_conv(desc, output, input, weights, bias);
+}
+
 static inline void conv_execute(eld_conv_t convs[], void **input,
                                 void **weights, void **output, void **bias,
                                 int C) {
@@ -397,7 +539,7 @@ static inline void conv_execute(eld_conv_t convs[], void **input,
         _input = output[c - 1];
     }
 
-    if (ELX_OK != elx_conv(_convs, _output, _input, _weights, _bias)) {
+    if (ELX_OK != conv_run(_convs, c, _output, _input, _weights, _bias)) {
       test::error("Fail: Convolution execution error!\n");
     }
   }
@@ -431,7 +573,7 @@ static inline void conv_bench(eld_conv_t convs[], eld_conv_t &conv_ref,
       }
 
       timer.start();
-      if (ELX_OK != elx_conv(_convs, _output, _input, _weights, _bias))
+      if (ELX_OK != conv_run(_convs, c, _output, _input, _weights, _bias))
         test::error("Fail: Convolution execution error!\n");
       timer.stop();
     }
@@ -448,7 +590,9 @@ int main(int argc, char **argv) {
   // 1, create convolution desc
   //    setup convolution
   eld_conv_t convs[RL_MAX];
+  eld_gemm_t gemm_descs[RL_MAX];
   eld_conv_t conv_ref;
+  gemms = gemm_descs;
   create_conv_desc(conv_ref, euler::test::FP32);
   if (conv_ref_setup(conv_ref) != ELD_OK) {
     printf("Fail: Convolution setup error!\n");
@@ -483,11 +627,28 @@ int main(int argc, char **argv) {
           in, wei, out, b, input_file, weights_file, bias_file, input_format,  \
           weights_format, reuse_inout, data_type_cfg, f16c_opt,                \
           validate_results);                                                   \
+      if (bn)                                                                  \
+        test::prepare_affine(conv_ref, convs[c]);                              \
+      if (output_quant_oc)                                                     \
+        test::prepare_output_quant_oc(conv_ref, convs[c], input_ref,           \
+            weights_ref, bias_ref, data_type_cfg, validate_results);           \
+      convs[c].observe = observe;                                              \
+      convs[c].input_view = {input_view_c, input_view_c_off, input_view_h,     \
+          input_view_h_off, input_view_w, input_view_w_off};                   \
+      convs[c].output_view = {output_view_c, output_view_c_off, output_view_h, \
+          output_view_h_off, output_view_w, output_view_w_off};                \
+      convs[c].input_prepadded = input_prepadded;                              \
                                                                                \
       if (convs[c].setup() != ELD_OK) {                                        \
         printf("Fail: Convolution setup error!\n");                            \
         return 0;                                                              \
       }                                                                        \
+      if (with_view)                                                           \
+        test::prepare_conv_view(convs[c], &input[c], &output[c]);              \
+      if (gemm && gemm_setup(convs[c], gemms[c]) != ELD_OK) {                  \
+        printf("Fail: GEMM setup error!\n");                                   \
+        return 0;                                                              \
+      }                                                                        \
     }                                                                          \
   } while (0)
 
@@ -520,6 +681,8 @@ int main(int argc, char **argv) {
   if (validate_results) {
     // 3. validate results
     eld_conv_t &conv_val = convs[C - 1];
+    if (with_view && test::finish_conv_view(conv_val, &output[C - 1]))
+      printf("Fail: Convolution output out of tensor view!\n");
     void *output_val = output[C - 1];
 
     printf("Validation: ");
@@ -537,6 +700,9 @@ int main(int argc, char **argv) {
         printf("Fail: Convolution results not correct!\n");
       else
         printf("Convolution Pass!\n");
+      if (observe && test::validate_calibration(conv_val, input_ref,
+                                                output_ref))
+        printf("Fail: Calibration not correct!\n");
       free(_output);
     }
   } else {
@@ -554,6 +720,10 @@ int main(int argc, char **argv) {
     free(weights[c]);
     free(output[c]);
     free(bias[c]);
+    free(convs[c].output_quant_oc.scale);
+    free(convs[c].output_quant_oc.z);
+    free(convs[c].affine.scale);
+    free(convs[c].affine.shift);
   }
 
   return 0;
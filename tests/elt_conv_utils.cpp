@@ -1,4 +1,5 @@
 #include <algorithm>
+#include <float.h>
 #include <math.h>
 #include <omp.h>
 #include <memory.h>
@@ -296,8 +297,8 @@ void prepare_conv_data(eld_conv_t &desc_ref, eld_conv_t &desc, float *input_ref,
       _output_ref = output_ref;
     }
 
-    if (test::ref_convolution2d<float>(desc_ref, _output_ref, input_ref,
-                                       weights_ref, bias_ref)) {
+    if (test::ref_conv_deconv_2d<float>(desc_ref, _output_ref, input_ref,
+                                        weights_ref, bias_ref)) {
       printf("Fail: scale initialization. Convolution ref execution error!\n");
       exit(1);
     }
@@ -310,7 +311,7 @@ void prepare_conv_data(eld_conv_t &desc_ref, eld_conv_t &desc, float *input_ref,
     float abs_cur = min > 0 ? min : -min;
     float abs_max = max > abs_cur ? max : abs_cur;
 
-    if (desc_ref.with_relu) {
+    if (desc_ref.with_relu && desc_ref.activation.alg == ACT_RELU) {
       oscale = abs_max / PRECISION_REPRESENTATION_7B;
       oz = 0.0;
       desc.output_quant.scale = oscale;
@@ -469,6 +470,9 @@ int compare_conv_results(eld_conv_t &desc, float *out, float *ref,
                          int data_type_cfg, bool is_int8_lp,
                          bool with_real_data) {
   double acc = is_int8_lp ? (with_real_data ? 1e-1 : 1e-2) : 1e-5;
+  // exp based activations amplify rounding of the conv result
+  if (desc.with_relu && desc.activation.alg >= ACT_SIGMOID)
+    acc = std::max(acc, 1e-4);
 
   if (desc.formats.output == nhwc) {
     acc = desc.with_relu ? 1.0 : acc;
@@ -484,6 +488,10 @@ int __compare_conv_results_blocked(eld_conv_t &desc, float *out, float *ref,
                                    int data_type_cfg, double acc) {
   const int V = 16;
   auto dims = desc.dims;
+  if (desc.with_pool) {
+    dims.oh = desc.pool.oh;
+    dims.ow = desc.pool.ow;
+  }
   int C = ALIGNUP(dims.oc, V) / V;
   int Or = dims.oc % V ? dims.oc % V : V;
 
@@ -543,6 +551,10 @@ int __compare_conv_results_blocked(eld_conv_t &desc, float *out, float *ref,
 int __compare_conv_results_nchw(eld_conv_t &desc, float *out, float *ref,
                                 int data_type_cfg, double acc) {
   auto dims = desc.dims;
+  if (desc.with_pool) {
+    dims.oh = desc.pool.oh;
+    dims.ow = desc.pool.ow;
+  }
   MD4(float, aout, out, dims.n, dims.oc, dims.oh, dims.ow);
   MD4(float, aref, ref, dims.n, dims.oc, dims.oh, dims.ow);
 
@@ -596,6 +608,10 @@ int __compare_conv_results_nchw(eld_conv_t &desc, float *out, float *ref,
 int __compare_conv_results_nhwc(eld_conv_t &desc, float *out, float *ref,
                                 int data_type_cfg, double acc) {
   auto dims = desc.dims;
+  if (desc.with_pool) {
+    dims.oh = desc.pool.oh;
+    dims.ow = desc.pool.ow;
+  }
   MD4(float, aout, out, dims.n, dims.oh, dims.ow, dims.oc);
   MD4(float, aref, ref, dims.n, dims.oh, dims.ow, dims.oc);
 
@@ -674,6 +690,23 @@ int cal_iterations(size_t num_ops) {
   return std::min(1024, std::max((int)iter, 64));
 }
 
+// Reference of activation epilogue, in double
+static inline float ref_activation(eld_conv_t &desc, float x) {
+  double v = x, alpha = desc.activation.alpha, beta = desc.activation.beta;
+  switch (desc.activation.alg) {
+  case ACT_RELU: return v < 0.0 ? 0.0f : x;
+  case ACT_LEAKY_RELU: return v < 0.0 ? alpha * v : v;
+  case ACT_CLIP: return v < alpha ? alpha : (v > beta ? beta : v);
+  case ACT_SIGMOID: return 1.0 / (1.0 + exp(-v));
+  case ACT_SWISH: return v / (1.0 + exp(-alpha * v));
+  case ACT_GELU_TANH:
+    return 0.5 * v
+        * (1.0 + tanh(sqrt(2.0 / M_PI) * (v + 0.044715 * v * v * v)));
+  case ACT_GELU_ERF: return 0.5 * v * erfc(-v / sqrt(2.0));
+  default: return x;
+  }
+}
+
 template <typename InputType, typename WeightsType, typename OutputType,
           typename BiasType>
 int ref_convolution2d(eld_conv_t &desc, OutputType *output, InputType *input,
@@ -710,12 +743,19 @@ int ref_convolution2d(eld_conv_t &desc, OutputType *output, InputType *input,
     tweights = (WeightsType *)malloc(desc.byte_sizes.weights);
     reorder<WeightsType, goihw, ghwio>(tweights, weights, g, oc, ic, kh, kw);
   }
+  // pooled output size, conv output before pooling in nchw
+  int ooh = desc.with_pool ? desc.pool.oh : oh;
+  int oow = desc.with_pool ? desc.pool.ow : ow;
+  OutputType *poutput = nullptr;
+  if (desc.with_pool)
+    poutput = (OutputType *)malloc(sizeof(OutputType) * n * g * oc * oh * ow);
+
   if (desc.formats.output == nChw16c) {
     toutput = (OutputType *)malloc(desc.byte_sizes.output);
-    reorder<OutputType, nchw, nChw16c>(toutput, output, n, g * oc, oh, ow);
+    reorder<OutputType, nchw, nChw16c>(toutput, output, n, g * oc, ooh, oow);
   } else if (desc.formats.output == nhwc) {
     toutput = (OutputType *)malloc(desc.byte_sizes.output);
-    reorder<OutputType, nchw, nhwc>(toutput, output, n, g * oc, oh, ow);
+    reorder<OutputType, nchw, nhwc>(toutput, output, n, g * oc, ooh, oow);
   }
 
   MD5(InputType, ainput, desc.formats.input == nchw ? input : tinput, n, g, ic,
@@ -725,8 +765,8 @@ int ref_convolution2d(eld_conv_t &desc, OutputType *output, InputType *input,
           ? weights
           : tweights,
       g, oc, ic, kh, kw);
-  MD5(OutputType, atoutput, desc.formats.output == nchw ? output : toutput, n,
-      g, oc, oh, ow);
+  MD5(OutputType, atoutput, desc.with_pool ? poutput
+      : desc.formats.output == nchw ? output : toutput, n, g, oc, oh, ow);
   MD2(BiasType, abias, bias, g, oc);
 
 #pragma omp parallel for collapse(5)
@@ -735,13 +775,7 @@ int ref_convolution2d(eld_conv_t &desc, OutputType *output, InputType *input,
       iter_each(_oc, oc) {
         iter_each(_oh, oh) {
           iter_each(_ow, ow) {
-            if (desc.with_ip_sum)
-              md5(atoutput, _n, _g, _oc, _oh, _ow) +=
-                  desc.with_bias ? md2(abias, _g, _oc) : 0.0f;
-            else
-              md5(atoutput, _n, _g, _oc, _oh, _ow) =
-                  desc.with_bias ? md2(abias, _g, _oc) : 0.0f;
-
+            float acc = desc.with_bias ? md2(abias, _g, _oc) : 0.0f;
             iter_each(_ic, ic) {
               iter_each(_kh, kh) {
                 int _ih = _oh * sh - pt + _kh * dh;
@@ -751,26 +785,63 @@ int ref_convolution2d(eld_conv_t &desc, OutputType *output, InputType *input,
                   int _iw = _ow * sw - pl + _kw * dw;
                   if (_iw < 0 || _iw >= iw)
                     continue;
-                  md5(atoutput, _n, _g, _oc, _oh, _ow) +=
-                      md5(ainput, _n, _g, _ic, _ih, _iw) *
-                      md5(aweights, _g, _oc, _ic, _kh, _kw);
+                  acc += md5(ainput, _n, _g, _ic, _ih, _iw) *
+                         md5(aweights, _g, _oc, _ic, _kh, _kw);
+                }
+              }
+            }
+            if (desc.affine.scale != nullptr) {
+              int _goc = _g * oc + _oc;
+              acc = acc * desc.affine.scale[_goc] +
+                    (desc.affine.shift ? desc.affine.shift[_goc] : 0.0f);
+            }
+            if (desc.with_ip_sum)
+              md5(atoutput, _n, _g, _oc, _oh, _ow) += acc;
+            else
+              md5(atoutput, _n, _g, _oc, _oh, _ow) = acc;
+            if (desc.with_relu)
+              md5(atoutput, _n, _g, _oc, _oh, _ow) = ref_activation(
+                  desc, md5(atoutput, _n, _g, _oc, _oh, _ow));
+          }
+        }
+      }
+    }
+  }
+
+  if (desc.with_pool) {
+    MD5(OutputType, apoutput, desc.formats.output == nchw ? output : toutput,
+        n, g, oc, ooh, oow);
+    int pkh = desc.pool.kh, pkw = desc.pool.kw;
+    int psh = desc.pool.sh, psw = desc.pool.sw;
+
+#pragma omp parallel for collapse(5)
+    iter_each(_n, n) {
+      iter_each(_g, g) {
+        iter_each(_oc, oc) {
+          iter_each(_oh, ooh) {
+            iter_each(_ow, oow) {
+              float r = desc.pool.alg == POOL_MAX ? -FLT_MAX : 0.0f;
+              iter_each(_kh, pkh) {
+                iter_each(_kw, pkw) {
+                  float v = md5(atoutput, _n, _g, _oc, _oh * psh + _kh,
+                                _ow * psw + _kw);
+                  r = desc.pool.alg == POOL_MAX ? std::max(r, v) : r + v;
                 }
               }
+              md5(apoutput, _n, _g, _oc, _oh, _ow) =
+                  desc.pool.alg == POOL_MAX ? r : r / (pkh * pkw);
             }
-            md5(atoutput, _n, _g, _oc, _oh, _ow) =
-                desc.with_relu && md5(atoutput, _n, _g, _oc, _oh, _ow) < 0.0f
-                    ? 0.0f
-                    : md5(atoutput, _n, _g, _oc, _oh, _ow);
           }
         }
       }
     }
+    free(poutput);
   }
 
   if (desc.formats.output == nChw16c) {
-    reorder<OutputType, nChw16c, nchw>(output, toutput, n, g * oc, oh, ow);
+    reorder<OutputType, nChw16c, nchw>(output, toutput, n, g * oc, ooh, oow);
   } else if (desc.formats.output == nhwc) {
-    reorder<OutputType, nhwc, nchw>(output, toutput, n, g * oc, oh, ow);
+    reorder<OutputType, nhwc, nchw>(output, toutput, n, g * oc, ooh, oow);
   }
 
   if (tinput != nullptr)
@@ -843,23 +914,28 @@ int ref_deconvolution2d(eld_conv_t &desc, OutputType *output, InputType *input,
 
           iter_each(_ic, ic) {
             iter_each(_kh, kh) {
-              int _ih = (_oh + pt - _kh) / sh;
-              if (_ih < 0 || _ih >= ih)
+              int _ihs = _oh + pt - _kh;
+              if (_ihs < 0 || _ihs % sh != 0 || _ihs / sh >= ih)
                 continue;
+              int _ih = _ihs / sh;
               iter_each(_kw, kw) {
-                int _iw = (_ow + pl - _kw) / sw;
-                if (_iw < 0 || _iw >= iw)
+                int _iws = _ow + pl - _kw;
+                if (_iws < 0 || _iws % sw != 0 || _iws / sw >= iw)
                   continue;
+                int _iw = _iws / sw;
                 md4(atoutput, _n, _oc, _oh, _ow) +=
                     md4(ainput, _n, _ic, _ih, _iw) *
                     md4(aweights, _oc, _ic, _kh, _kw);
               }
             }
           }
-          md4(atoutput, _n, _oc, _oh, _ow) =
-              desc.with_relu && md4(atoutput, _n, _oc, _oh, _ow) < 0.0f
-                  ? 0.0f
-                  : md4(atoutput, _n, _oc, _oh, _ow);
+          if (desc.affine.scale != nullptr)
+            md4(atoutput, _n, _oc, _oh, _ow) =
+                md4(atoutput, _n, _oc, _oh, _ow) * desc.affine.scale[_oc] +
+                (desc.affine.shift ? desc.affine.shift[_oc] : 0.0f);
+          if (desc.with_relu)
+            md4(atoutput, _n, _oc, _oh, _ow) = ref_activation(
+                desc, md4(atoutput, _n, _oc, _oh, _ow));
         }
       }
     }
@@ -885,7 +961,7 @@ template <typename InputType, typename WeightsType, typename OutputType,
           typename BiasType>
 int ref_conv_deconv_2d(eld_conv_t &desc, OutputType *output, InputType *input,
                       WeightsType *weights, BiasType *bias) {
-  if (desc.algorithm == DECONV_DIRECT) {
+  if (desc.algorithm == DECONV_DIRECT || desc.algorithm == DECONV_SUBPIXEL) {
     return ref_deconvolution2d<InputType, WeightsType, OutputType, BiasType>(
         desc, output, input, weights, bias);
   } else {
@@ -894,8 +970,289 @@ int ref_conv_deconv_2d(eld_conv_t &desc, OutputType *output, InputType *input,
   }
 }
 
+static inline int output_oc_index(eld_conv_t &desc, size_t i) {
+  const int V = 16;
+  auto dims = desc.dims;
+  if (desc.formats.output == nhwc)
+    return i % dims.oc;
+  else if (desc.formats.output == nchw)
+    return (i / (dims.oh * dims.ow)) % dims.oc;
+  else
+    return (i / (dims.oh * dims.ow * V)) % (ALIGNUP(dims.oc, V) / V) * V
+        + i % V;
+}
+
+void prepare_output_quant_oc(eld_conv_t &desc_ref, eld_conv_t &desc,
+                             float *input_ref, float *weights_ref,
+                             float *bias_ref, int data_type_cfg,
+                             bool validate_results) {
+  int oc = desc.dims.oc;
+  float *oscale = (float *)malloc(oc * sizeof(float));
+  float *oz = (float *)malloc(oc * sizeof(float));
+  desc.output_quant_oc.scale = oscale;
+  desc.output_quant_oc.z = oz;
+
+  if (!validate_results) {
+    iter_each (_oc, oc) {
+      oscale[_oc] = desc.output_quant.scale;
+      oz[_oc] = desc.output_quant.z;
+    }
+    return;
+  }
+
+  float *_output_ref;
+  MEMALIGN64(&_output_ref, desc_ref.byte_sizes.output);
+  if (test::ref_conv_deconv_2d<float>(desc_ref, _output_ref, input_ref,
+                                      weights_ref, bias_ref)) {
+    printf("Fail: per-oc scale initialization. Convolution ref execution "
+           "error!\n");
+    exit(1);
+  }
+
+  float *min = (float *)malloc(oc * sizeof(float));
+  float *max = (float *)malloc(oc * sizeof(float));
+  iter_each (_oc, oc) {
+    min[_oc] = FLT_MAX;
+    max[_oc] = -FLT_MAX;
+  }
+  for (size_t i = 0; i < desc_ref.sizes.output; i++) {
+    int _oc = output_oc_index(desc_ref, i);
+    if (_oc >= oc)
+      continue;
+    min[_oc] = _output_ref[i] < min[_oc] ? _output_ref[i] : min[_oc];
+    max[_oc] = _output_ref[i] > max[_oc] ? _output_ref[i] : max[_oc];
+  }
+
+  iter_each (_oc, oc) {
+    float abs_cur = min[_oc] > 0 ? min[_oc] : -min[_oc];
+    float abs_max = max[_oc] > abs_cur ? max[_oc] : abs_cur;
+    if (desc_ref.with_relu ||
+        data_type_cfg == euler::test::U8F32S8F32 ||
+        data_type_cfg == euler::test::U8F32S8F32z) {
+      oscale[_oc] = (abs_max + 0.000001) / PRECISION_REPRESENTATION_7B;
+      oz[_oc] = 0.0;
+    } else {
+      auto diff = max[_oc] - min[_oc] + 0.000001;
+      oscale[_oc] = diff / PRECISION_REPRESENTATION_7B;
+      oz[_oc] = -min[_oc] * PRECISION_REPRESENTATION_7B / diff;
+    }
+  }
+  printf("output per-oc scale [0] %f [%d] %f\n", oscale[0], oc - 1,
+         oscale[oc - 1]);
+
+  free(min);
+  free(max);
+  free(_output_ref);
+}
+
+void prepare_affine(eld_conv_t &desc_ref, eld_conv_t &desc) {
+  int oc = desc.dims.oc;
+  float *scale = (float *)malloc(oc * sizeof(float));
+  float *shift = (float *)malloc(oc * sizeof(float));
+  std::vector<float> mean(oc), var(oc), gamma(oc), beta(oc);
+  std::default_random_engine gen;
+  std::normal_distribution<float> dMean(0.0, 2.0);
+  std::uniform_real_distribution<float> dVar(0.5, 4.0);
+  std::uniform_real_distribution<float> dGamma(0.5, 1.5);
+  std::normal_distribution<float> dBeta(0.0, 1.0);
+  iter_each (_oc, oc) {
+    mean[_oc] = dMean(gen);
+    var[_oc] = dVar(gen);
+    gamma[_oc] = dGamma(gen);
+    beta[_oc] = dBeta(gen);
+  }
+  desc.fold_batch_norm(scale, shift, mean.data(), var.data(), gamma.data(),
+                       beta.data(), 1e-5f);
+  desc_ref.affine = desc.affine;
+}
+
+using view_t = decltype(eld_conv_t::input_view);
+
+// View of dims C x H x W if not given
+static view_t conv_view_dims(view_t v, int C, int H, int W) {
+  if (v.c == 0) { v.c = C; v.c_off = 0; }
+  if (v.h == 0) { v.h = H; v.h_off = 0; }
+  if (v.w == 0) { v.w = W; v.w_off = 0; }
+  return v;
+}
+
+// Copy between dense tensor of n x C x H x W and its region in view
+// tensor v. to_view: dense to view.
+static void copy_conv_view(char *view, char *dense, int fmt, view_t v, int n,
+    int C, int H, int W, size_t esize, bool to_view) {
+  // L channels a pixel of view/dense
+  int L = fmt == nChw16c ? 16 : fmt == nhwc ? C : 1;
+  int vL = fmt == nhwc ? v.c : L;
+  int C2 = fmt == nhwc ? 1 : ALIGNUP(C, L) / L;
+  int vC2 = fmt == nhwc ? 1 : ALIGNUP(v.c, L) / L;
+  int c2_off = fmt == nhwc ? 0 : v.c_off / L;
+  int c_off = fmt == nhwc ? v.c_off : 0;
+#pragma omp parallel for collapse(3)
+  for (int _n = 0; _n < n; _n++) {
+    for (int _C2 = 0; _C2 < C2; _C2++) {
+      for (int _h = 0; _h < H; _h++) {
+        for (int _w = 0; _w < W; _w++) {
+          size_t vi = ((((size_t)_n * vC2 + c2_off + _C2) * v.h + v.h_off
+              + _h) * v.w + v.w_off + _w) * vL + c_off;
+          size_t di = ((((size_t)_n * C2 + _C2) * H + _h) * W + _w) * L;
+          if (to_view)
+            memcpy(view + vi * esize, dense + di * esize, L * esize);
+          else
+            memcpy(dense + di * esize, view + vi * esize, L * esize);
+        }
+      }
+    }
+  }
+}
+
+#define VIEW_GUARD 0x7f
+
+void prepare_conv_view(eld_conv_t &desc, void **input, void **output) {
+  int OH = desc.with_pool ? desc.pool.oh : desc.dims.oh;
+  int OW = desc.with_pool ? desc.pool.ow : desc.dims.ow;
+  // pre-padded input: padded input of zero halo
+  int pt = desc.input_prepadded ? desc.pads.t : 0;
+  int pl = desc.input_prepadded ? desc.pads.l : 0;
+  int IH = desc.dims.ih + (desc.input_prepadded ? pt + desc.pads.b : 0);
+  int IW = desc.dims.iw + (desc.input_prepadded ? pl + desc.pads.r : 0);
+  view_t iv = conv_view_dims(desc.input_view, desc.dims.ic, IH, IW);
+  view_t ov = conv_view_dims(desc.output_view, desc.dims.oc, OH, OW);
+  size_t iesize = desc.byte_sizes.input / desc.sizes.input;
+  char *vinput, *voutput;
+
+  MEMALIGN64(&vinput, desc.byte_sizes.input);
+  MEMALIGN64(&voutput, desc.byte_sizes.output);
+  memset(vinput, VIEW_GUARD, desc.byte_sizes.input);
+  memset(voutput, VIEW_GUARD, desc.byte_sizes.output);
+  if (desc.input_prepadded) {
+    size_t Cp = desc.formats.input == nChw16c ? ALIGNUP(desc.dims.ic, 16)
+                                              : desc.dims.ic;
+    size_t size = desc.dims.n * Cp * IH * IW * iesize;
+    char *halo;
+    MEMALIGN64(&halo, size);
+    memset(halo, 0, size);
+    copy_conv_view(vinput, halo, desc.formats.input, iv, desc.dims.n,
+        desc.dims.ic, IH, IW, iesize, true);
+    free(halo);
+    iv.h_off += pt;
+    iv.w_off += pl;
+  }
+  copy_conv_view(vinput, (char *)*input, desc.formats.input, iv, desc.dims.n,
+      desc.dims.ic, desc.dims.ih, desc.dims.iw, iesize, true);
+  copy_conv_view(voutput, (char *)*output, desc.formats.output, ov,
+      desc.dims.n, desc.dims.oc, OH, OW,
+      desc.byte_sizes.output / desc.sizes.output, true);
+  free(*input);
+  free(*output);
+  *input = vinput;
+  *output = voutput;
+}
+
+int finish_conv_view(eld_conv_t &desc, void **output) {
+  int OH = desc.with_pool ? desc.pool.oh : desc.dims.oh;
+  int OW = desc.with_pool ? desc.pool.ow : desc.dims.ow;
+  view_t ov = conv_view_dims(desc.output_view, desc.dims.oc, OH, OW);
+  size_t esize = desc.byte_sizes.output / desc.sizes.output;
+  size_t Cp = desc.formats.output == nChw16c ? ALIGNUP(desc.dims.oc, 16)
+                                             : desc.dims.oc;
+  size_t size = desc.dims.n * OH * OW * Cp * esize;
+  char *voutput = (char *)*output, *dense, *guard;
+
+  MEMALIGN64(&dense, size);
+  MEMALIGN64(&guard, size);
+  memset(guard, VIEW_GUARD, size);
+  copy_conv_view(voutput, dense, desc.formats.output, ov, desc.dims.n,
+      desc.dims.oc, OH, OW, esize, false);
+  // out of region must be untouched
+  copy_conv_view(voutput, guard, desc.formats.output, ov, desc.dims.n,
+      desc.dims.oc, OH, OW, esize, true);
+  int err = 0;
+  for (size_t i = 0; i < desc.byte_sizes.output; i++) {
+    if (voutput[i] != VIEW_GUARD) {
+      err = -1;
+      break;
+    }
+  }
+  free(guard);
+  free(voutput);
+  *output = dense;
+  // desc of the dense output for post processing
+  desc.sizes.output = size / esize;
+  desc.byte_sizes.output = size;
+  desc.output_view = {0, 0, 0, 0, 0, 0};
+  return err;
+}
+
+// Observed FP32 desc: min/max calibration must match the reference data,
+// KL/percentile ranges must be within min/max.
+int validate_calibration(eld_conv_t &desc, float *input_ref,
+                         float *output_ref) {
+  auto minmax = [](float *data, size_t size, float &min, float &max) {
+    min = 0.0f;
+    max = 0.0f;
+    for (size_t i = 0; i < size; i++) {
+      min = data[i] < min ? data[i] : min;
+      max = data[i] > max ? data[i] : max;
+    }
+  };
+  auto near = [](float a, float b) {
+    return fabs(a - b) <= 1e-4 * (fabs(a) > fabs(b) ? fabs(a) : fabs(b))
+        + 1e-6;
+  };
+
+  float imin, imax, omin, omax;
+  minmax(input_ref, desc.sizes.input, imin, imax);
+  minmax(output_ref, desc.sizes.output, omin, omax);
+  float iabs = -imin > imax ? -imin : imax;
+
+  int ret = 0;
+  eld_conv_t q[3];
+  int methods[] = { CALIB_MINMAX, CALIB_PERCENTILE, CALIB_KL };
+  iter_each (_m, 3) {
+    q[_m].data_type = {euler::u8, euler::f32, euler::u8, euler::f32};
+    q[_m].dims = desc.dims;
+    if (desc.calibrate(q[_m], methods[_m]) != ELD_OK)
+      return -1;
+    printf("calibration method %d: input scale %f z %f, tinput scale %f "
+           "z %f, output scale %f z %f\n", methods[_m],
+           q[_m].input_quant.scale, q[_m].input_quant.z,
+           q[_m].wino_tinput_quant.scale, q[_m].wino_tinput_quant.z,
+           q[_m].output_quant.scale, q[_m].output_quant.z);
+    if (q[_m].input_quant.scale > q[0].input_quant.scale * 1.0001f ||
+        q[_m].output_quant.scale > q[0].output_quant.scale * 1.0001f)
+      ret = -1;
+  }
+
+  // Min-max: u8 input abs-max, u8 output asymmetric unless non-negative
+  if (!near(q[0].input_quant.scale,
+          (iabs + 0.000001) / PRECISION_REPRESENTATION_7B) ||
+      q[0].input_quant.z != (imin < 0.0f ? 128.0f : 0.0f))
+    ret = -1;
+  float oscale = omin < 0.0f
+      ? (omax - omin + 0.000001) / PRECISION_REPRESENTATION_7B
+      : (omax + 0.000001) / PRECISION_REPRESENTATION_7B;
+  float oz = omin < 0.0f ? -omin / oscale : 0.0f;
+  if (!near(q[0].output_quant.scale, oscale) ||
+      !near(q[0].output_quant.z, oz))
+    ret = -1;
+
+  return ret;
+}
+
 void post_process_conv_results(float *output_ref, eld_conv_t &desc,
                                void *output_res, int data_type_cfg) {
+  auto output_quant = [&](size_t i, float &S, float &z) {
+    S = desc.output_quant.scale;
+    z = desc.output_quant.z;
+    if (desc.output_quant_oc.scale != nullptr) {
+      int _oc = output_oc_index(desc, i);
+      if (_oc < desc.dims.oc) {
+        S = desc.output_quant_oc.scale[_oc];
+        z = desc.output_quant_oc.z[_oc];
+      }
+    }
+  };
+
   if (data_type_cfg == euler::test::FP32 ||
       data_type_cfg == euler::test::FP16O ||
       data_type_cfg == euler::test::U8F32F32F32) {
@@ -914,7 +1271,9 @@ void post_process_conv_results(float *output_ref, eld_conv_t &desc,
 #pragma omp parallel for
     for (size_t i = 0; i < desc.sizes.output; i++) {
       float resu8 = (float)_output_res[i];
-      output_ref[i] = (resu8 - desc.output_quant.z) * desc.output_quant.scale;
+      float S, z;
+      output_quant(i, S, z);
+      output_ref[i] = (resu8 - z) * S;
     }
   } else if (data_type_cfg == euler::test::U8F32S8F32 ||
              data_type_cfg == euler::test::U8F32S8F32z) {
@@ -922,7 +1281,9 @@ void post_process_conv_results(float *output_ref, eld_conv_t &desc,
 #pragma omp parallel for
     for (size_t i = 0; i < desc.sizes.output; i++) {
       float resi8 = (float)_output_res[i];
-      output_ref[i] = (resi8 - desc.output_quant.z) * desc.output_quant.scale;
+      float S, z;
+      output_quant(i, S, z);
+      output_ref[i] = (resi8 - z) * S;
     }
   }
 }
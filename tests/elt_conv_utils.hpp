@@ -47,6 +47,21 @@ namespace test {
   void post_process_conv_results(float *ouput_ref, eld_conv_t &desc,
       void *output_res, int data_type_cfg);
 
+  void prepare_output_quant_oc(eld_conv_t &desc_ref, eld_conv_t &desc,
+      float *input_ref, float *weights_ref, float *bias_ref,
+      int data_type_cfg, bool validate_results = false);
+
+  void prepare_affine(eld_conv_t &desc_ref, eld_conv_t &desc);
+
+  // Replace dense input/output by tensor views of desc holding them
+  void prepare_conv_view(eld_conv_t &desc, void **input, void **output);
+  // Replace view output by dense one described by desc then, -1 if out of
+  // region written
+  int finish_conv_view(eld_conv_t &desc, void **output);
+
+  int validate_calibration(eld_conv_t &desc, float *input_ref,
+      float *output_ref);
+
   size_t cal_ops(eld_conv_t &desc);
   int cal_iterations(size_t num_ops);
 
@@ -26,7 +26,7 @@ DEFINE_bool(dbuffering, false, "Double buffering. Default: off");
 DEFINE_bool(output_as_input, false,
             "Output of layer n used as input of layer n+1. Default: off");
 DEFINE_string(alg, "wino",
-              "deconv|auto|wino|direct|direct_1x1. Algorithm. Default: wino");
+              "deconv|deconv_subpixel|auto|wino|direct|direct_1x1. Algorithm. Default: wino");
 DEFINE_int32(tile_size, 5, "Winograd tile size: 5");
 DEFINE_int32(nthreads, 1, "Number of threads per team");
 DEFINE_string(execution_mode, "0x0", "Execution mode");
@@ -55,6 +55,49 @@ DEFINE_bool(output_as_blocked, false,
 DEFINE_bool(f16c_opt, false, "on|off. With half-precision opt, Default: off");
 DEFINE_string(data_type_cfg, "FP32", "UserTypes, Default: FP32");
 DEFINE_bool(with_ip_sum, false, "on|off. With inplace sum, Default: off");
+DEFINE_bool(output_quant_oc, false,
+    "on|off. Per output channel output quantization, Default: off");
+DEFINE_bool(observe, false,
+    "on|off. FP32 observe mode and calibration check, Default: off");
+DEFINE_bool(bn, false,
+    "on|off. Folded inference batch-norm epilogue, Default: off");
+DEFINE_string(pool, "off", "off|max|avg. Fused pooling, Default: off");
+DEFINE_int32(pool_k, 2, "Fused pooling window, Default: 2");
+DEFINE_int32(pool_s, 2, "Fused pooling stride, Default: 2");
+DEFINE_string(act, "relu",
+    "relu|leaky_relu|clip|sigmoid|swish|gelu_tanh|gelu_erf. Activation "
+    "epilogue, implies with_relu if not relu, Default: relu");
+DEFINE_double(act_alpha, 0.0, "Activation alpha, Default: 0");
+DEFINE_double(act_beta, 0.0, "Activation beta, Default: 0");
+DEFINE_int32(input_view_c, 0,
+    "Channels of input tensor the conv input is a slice of, 0 for off, "
+    "Default: 0");
+DEFINE_int32(input_view_c_off, 0, "Input slice channel offset, Default: 0");
+DEFINE_int32(output_view_c, 0,
+    "Channels of output tensor the conv output is a slice of, 0 for off, "
+    "Default: 0");
+DEFINE_int32(output_view_c_off, 0, "Output slice channel offset, Default: 0");
+DEFINE_int32(input_view_h, 0,
+    "Height of input tensor the conv input is a region of, 0 for ih, "
+    "Default: 0");
+DEFINE_int32(input_view_h_off, 0, "Input region row offset, Default: 0");
+DEFINE_int32(input_view_w, 0,
+    "Width of input tensor the conv input is a region of, 0 for iw, "
+    "Default: 0");
+DEFINE_int32(input_view_w_off, 0, "Input region column offset, Default: 0");
+DEFINE_int32(output_view_h, 0,
+    "Height of output tensor the conv output is a region of, 0 for oh, "
+    "Default: 0");
+DEFINE_int32(output_view_h_off, 0, "Output region row offset, Default: 0");
+DEFINE_int32(output_view_w, 0,
+    "Width of output tensor the conv output is a region of, 0 for ow, "
+    "Default: 0");
+DEFINE_int32(output_view_w_off, 0, "Output region column offset, Default: 0");
+DEFINE_bool(input_prepadded, false,
+    "on|off. Input given with zero halo of padding, Default: off");
+DEFINE_int32(gemm, 0,
+    "0|1|2. Run 1x1 conv (nhwc output) as GEMM of eld_gemm_t: 1, elx_gemm; "
+    "2, elx_gemm_batch of image pointers, FP32. Default: 0");
 DEFINE_int32(sampling_kind, 2,
              "sampling kind 0: FINE, 1: COARSE, 2: CALIBRATED, Default: 2");
 DEFINE_double(tinput_cali_s, 0.0,
@@ -52,6 +52,29 @@ DECLARE_bool(output_as_blocked);
 DECLARE_bool(f16c_opt);
 DECLARE_string(data_type_cfg);
 DECLARE_bool(with_ip_sum);
+DECLARE_bool(output_quant_oc);
+DECLARE_bool(observe);
+DECLARE_bool(bn);
+DECLARE_string(pool);
+DECLARE_int32(pool_k);
+DECLARE_int32(pool_s);
+DECLARE_string(act);
+DECLARE_double(act_alpha);
+DECLARE_double(act_beta);
+DECLARE_int32(input_view_c);
+DECLARE_int32(input_view_c_off);
+DECLARE_int32(output_view_c);
+DECLARE_int32(output_view_c_off);
+DECLARE_int32(input_view_h);
+DECLARE_int32(input_view_h_off);
+DECLARE_int32(input_view_w);
+DECLARE_int32(input_view_w_off);
+DECLARE_int32(output_view_h);
+DECLARE_int32(output_view_h_off);
+DECLARE_int32(output_view_w);
+DECLARE_int32(output_view_w_off);
+DECLARE_bool(input_prepadded);
+DECLARE_int32(gemm);
 DECLARE_int32(sampling_kind);
 DECLARE_double(tinput_cali_s);
 DECLARE_double(tinput_cali_z);